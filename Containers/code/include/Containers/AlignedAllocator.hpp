@@ -0,0 +1,70 @@
+/**
+ * @file AlignedAllocator.hpp
+ * @brief Over-aligned and padded allocator, for buffers processed by vector kernels.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "Storage.hpp"
+#include <bit>
+#include <cstddef>
+#include <new>
+
+namespace eho {
+    /**
+     * Allocates the buffers aligned to t_uAlignment bytes and padded to a whole multiple of t_uAlignment bytes,
+     * so the last element's vector can be loaded without reading past the allocation.
+     * @tparam t_tType
+     * @tparam t_uAlignment Alignment of the buffers, e.g. 32 for AVX or 64 for AVX-512 and cache lines.
+     */
+    template<typename t_tType, size_t t_uAlignment>
+    requires(std::has_single_bit(t_uAlignment))
+    class CAlignedAllocator {
+    public:
+        using value_type = t_tType;
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        static constexpr size_t alignment = std::max(t_uAlignment, alignof(t_tType));
+
+        template<typename t_tOther>
+        struct rebind {
+            using other = CAlignedAllocator<t_tOther, t_uAlignment>;
+        };
+
+        CAlignedAllocator() = default;
+
+        template<typename t_tOther>
+        CAlignedAllocator(const CAlignedAllocator<t_tOther, t_uAlignment> &) noexcept {}
+
+        t_tType *allocate(size_t uCount) {
+            return static_cast<t_tType *>(::operator new(Bytes(uCount), std::align_val_t{alignment}));
+        }
+
+        void deallocate(t_tType *ptr, size_t uCount) noexcept {
+            ::operator delete(static_cast<void *>(ptr), Bytes(uCount), std::align_val_t{alignment});
+        }
+
+        template<typename t_tOther>
+        bool operator==(const CAlignedAllocator<t_tOther, t_uAlignment> &) const noexcept {
+            return true;
+        }
+
+    private:
+        static constexpr size_t Bytes(size_t uCount) {
+            return (uCount * sizeof(t_tType) + alignment - 1) & ~(alignment - 1);
+        }
+    };
+
+    template<typename t_tType, size_t t_uAlignment>
+    struct is_trivially_relocatable<CAlignedAllocator<t_tType, t_uAlignment>> : std::true_type {
+    };
+}
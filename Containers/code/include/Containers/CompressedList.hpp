@@ -0,0 +1,405 @@
+/**
+ * @file CompressedList.hpp
+ * @brief Append only list of sorted integers, compressed in blocks of bit packed deltas.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "List.hpp"
+#include "Simd.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
+namespace eho::Internal {
+    /**
+     * Values per compressed block.
+     */
+    inline constexpr size_t s_uCompressedBlockSize = 128;
+
+    /**
+     * Lanes of the packed blocks, a 128 bits register of words. The value i of a block is in the lane
+     * i % lanes, each lane packs its values one after the other in its own words, so a block of b bits
+     * values takes exactly b words per lane.
+     */
+    template<typename t_tType>
+    inline constexpr size_t s_uCompressedLanes = 16 / sizeof(t_tType);
+
+    /**
+     * Decodes a packed block: unpacks the deltas, patches the exceptions' high bits and sums the deltas
+     * of each lane, the first row being relative to Base.
+     * The unpacking is instantiated for every width, so the words and shifts of the rows are constants
+     * and only the lanes are left to the vector instructions.
+     */
+    template<typename t_tType>
+    struct CDecodeKernel {
+        static constexpr size_t s_uWordBits = sizeof(t_tType) * 8;
+        static constexpr size_t s_uLanes = s_uCompressedLanes<t_tType>;
+        static constexpr size_t s_uRows = s_uCompressedBlockSize / s_uLanes;
+
+        [[gnu::always_inline]] static inline void Run(const t_tType *pWords, size_t uBits, const uint8_t *pPositions,
+                                                      const t_tType *pExceptions, size_t uExceptions, t_tType Base,
+                                                      t_tType *pOut) {
+            UnpackWidth(uBits, pWords, pOut, std::make_index_sequence<s_uWordBits + 1>{});
+
+            for (size_t i = 0; i < uExceptions; ++i) {
+                pOut[pPositions[i]] |= pExceptions[i] << uBits;
+            }
+
+            // The running sums stay in a register instead of being reloaded from the previous row
+            t_tType arSums[s_uLanes];
+            std::fill_n(arSums, s_uLanes, Base);
+            for (size_t r = 0; r < s_uRows; ++r) {
+                for (size_t j = 0; j < s_uLanes; ++j) {
+                    arSums[j] += pOut[r * s_uLanes + j];
+                }
+                std::copy_n(arSums, s_uLanes, pOut + r * s_uLanes);
+            }
+        }
+
+        // No lambdas, they would not be inlined into the kernels compiled for the instruction sets
+        template<size_t... t_uBits>
+        [[gnu::always_inline]] static inline void UnpackWidth(size_t uBits, const t_tType *pWords, t_tType *pOut,
+                                                              std::index_sequence<t_uBits...>) {
+            ((uBits == t_uBits ? UnpackRows<t_uBits>(pWords, pOut, std::make_index_sequence<s_uRows>{}) : void()), ...);
+        }
+
+        template<size_t t_uBits, size_t... t_uRows>
+        [[gnu::always_inline]] static inline void UnpackRows(const t_tType *pWords, t_tType *pOut,
+                                                             std::index_sequence<t_uRows...>) {
+            if constexpr (t_uBits == 0) {
+                std::fill_n(pOut, s_uCompressedBlockSize, t_tType{0});
+            } else {
+                (UnpackRow<t_uBits, t_uRows>(pWords, pOut), ...);
+            }
+        }
+
+        template<size_t t_uBits, size_t t_uRow>
+        [[gnu::always_inline]] static inline void UnpackRow(const t_tType *pWords, t_tType *pOut) {
+            constexpr t_tType Mask = t_uBits == s_uWordBits ? ~t_tType{0} : (t_tType{1} << t_uBits) - 1;
+            constexpr size_t uWord = t_uRow * t_uBits / s_uWordBits;
+            constexpr size_t uShift = t_uRow * t_uBits % s_uWordBits;
+            const t_tType *pLow = pWords + uWord * s_uLanes;
+            // The row is read before it is stored, pOut may alias pWords as far as the compiler knows
+            t_tType arRow[s_uLanes];
+            for (size_t j = 0; j < s_uLanes; ++j) {
+                if constexpr (uShift + t_uBits > s_uWordBits) {
+                    arRow[j] = (pLow[j] >> uShift | pLow[s_uLanes + j] << (s_uWordBits - uShift)) & Mask;
+                } else {
+                    arRow[j] = pLow[j] >> uShift & Mask;
+                }
+            }
+            std::copy_n(arRow, s_uLanes, pOut + t_uRow * s_uLanes);
+        }
+    };
+}
+
+namespace eho {
+    /**
+     * Append only list of ascending unsigned integers, e.g. huge sorted ID lists, several times smaller
+     * than a CList when the gaps between the values are small.
+     * <br/><br/>
+     * Every 128 values are compressed in a block: each value is stored as its difference with the value
+     * one lane earlier (see Internal::s_uCompressedLanes), bit packed with the width that minimises the
+     * block's size. The few larger differences are patched from a list of exceptions (patched frame of
+     * reference). The last, incomplete, block is kept uncompressed.
+     * <br/><br/>
+     * The blocks are decoded with the SIMD kernels of eho::Simd. lower_bound() binary searches the first
+     * value of the blocks and decodes a single block. The iterators are forward and hold a decoded block,
+     * they are invalidated by push_back().
+     */
+    template<std::unsigned_integral t_tType>
+    requires(sizeof(t_tType) == 4 || sizeof(t_tType) == 8)
+    class CCompressedList {
+    protected:
+        static constexpr size_t s_uBlockSize = Internal::s_uCompressedBlockSize;
+        static constexpr size_t s_uLanes = Internal::s_uCompressedLanes<t_tType>;
+        static constexpr size_t s_uWordBits = sizeof(t_tType) * 8;
+
+        /**
+         * Packed block: its first word, its first exception, its amount of exceptions and its width.
+         */
+        struct CBlock {
+            size_t m_uOffset;
+            uint32_t m_uException;
+            uint8_t m_uExceptions;
+            uint8_t m_uBits;
+        };
+
+    public:
+        /**
+         * Forward iterator over the values, it decodes the blocks it enters.
+         */
+        class CIterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = t_tType;
+            using reference = t_tType;
+
+            CIterator() = default;
+
+            CIterator(const CCompressedList *pList, size_t uIndex) : m_pList{pList}, m_uIndex{uIndex} {
+                if (m_uIndex < m_pList->size()) {
+                    Load();
+                }
+            }
+
+            t_tType operator*() const {
+                size_t uPosition = m_uIndex % s_uBlockSize;
+                return m_bTail ? m_pList->m_arTail[uPosition] : m_arBuffer[uPosition];
+            }
+
+            CIterator &operator++() {
+                ++m_uIndex;
+                if (m_uIndex % s_uBlockSize == 0 && m_uIndex < m_pList->size()) {
+                    Load();
+                }
+                return *this;
+            }
+
+            CIterator operator++(int) {
+                CIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            // The iterators of the same list share it, the index is enough
+            bool operator==(const CIterator &it) const { return m_uIndex == it.m_uIndex; }
+
+        private:
+            friend class CCompressedList;
+
+            const CCompressedList *m_pList{nullptr};
+            size_t m_uIndex{0};
+            bool m_bTail{false};
+            std::array<t_tType, s_uBlockSize> m_arBuffer{};
+
+            void Load() {
+                size_t uBlock = m_uIndex / s_uBlockSize;
+                m_bTail = uBlock == m_pList->m_lstBlocks.size();
+                if (!m_bTail) {
+                    m_pList->decode(uBlock, m_arBuffer.data());
+                }
+            }
+
+            /**
+             * Current block's values.
+             */
+            const t_tType *Values() const {
+                return m_bTail ? m_pList->m_arTail.data() : m_arBuffer.data();
+            }
+        };
+
+        CCompressedList() = default;
+
+        /**
+         * Appends Value, it must not be smaller than the last value.
+         * Completing a block compresses it.
+         */
+        void push_back(t_tType Value) {
+            if (m_uSize != 0 && Value < back()) {
+                throw std::invalid_argument{"The values must be ascending"};
+            }
+
+            m_arTail[m_uSize % s_uBlockSize] = Value;
+            m_uBack = Value;
+            ++m_uSize;
+            if (m_uSize % s_uBlockSize == 0) {
+                Compress();
+            }
+        }
+
+        /**
+         * Appends the ascending values of Range.
+         */
+        template<std::ranges::input_range t_tRange>
+        requires std::convertible_to<std::ranges::range_reference_t<t_tRange>, t_tType>
+        void append_range(t_tRange &&Range) {
+            for (t_tType Value: Range) {
+                push_back(Value);
+            }
+        }
+
+        size_t size() const {
+            return m_uSize;
+        }
+
+        bool empty() const {
+            return m_uSize == 0;
+        }
+
+        t_tType front() const {
+            return m_lstBases.empty() ? m_arTail[0] : m_lstBases[0];
+        }
+
+        t_tType back() const {
+            return m_uBack;
+        }
+
+        /**
+         * Amount of blocks, the compressed ones and the incomplete one if any.
+         */
+        size_t blocks() const {
+            return (m_uSize + s_uBlockSize - 1) / s_uBlockSize;
+        }
+
+        /**
+         * Bytes used by the values, to compare with size() * sizeof(t_tType).
+         */
+        size_t compressed_size() const {
+            return m_lstWords.size() * sizeof(t_tType) + m_lstBases.size() * (sizeof(t_tType) + sizeof(CBlock)) +
+                   m_lstPositions.size() + m_lstExceptions.size() * sizeof(t_tType) + sizeof(m_arTail);
+        }
+
+        CIterator begin() const {
+            return {this, 0};
+        }
+
+        CIterator end() const {
+            return {this, m_uSize};
+        }
+
+        /**
+         * Decodes the block uBlock into pOut, with the kernel of eLevel.
+         * @return The amount of values of the block, s_uBlockSize but for the incomplete last block.
+         */
+        size_t decode(size_t uBlock, t_tType *pOut, Simd::ELevel eLevel = Simd::level()) const {
+            if (uBlock >= blocks()) {
+                throw std::out_of_range{"Requested block is out of range"};
+            }
+
+            if (uBlock == m_lstBlocks.size()) {
+                std::copy_n(m_arTail.data(), m_uSize % s_uBlockSize, pOut);
+                return m_uSize % s_uBlockSize;
+            }
+
+            const CBlock &Block = m_lstBlocks.data()[uBlock];
+            Internal::RunSimd<Internal::CDecodeKernel<t_tType>>(
+                    eLevel, m_lstWords.data() + Block.m_uOffset, size_t{Block.m_uBits},
+                    m_lstPositions.data() + Block.m_uException, m_lstExceptions.data() + Block.m_uException,
+                    size_t{Block.m_uExceptions}, m_lstBases.data()[uBlock], pOut);
+            return s_uBlockSize;
+        }
+
+        /**
+         * First value not smaller than Value, or end().
+         * Only the block that may hold it is decoded.
+         */
+        CIterator lower_bound(t_tType Value) const {
+            // The bound is in the last block starting before Value, or it is the first value of the next one
+            auto uBlock = static_cast<size_t>(std::ranges::lower_bound(m_lstBases, Value) - m_lstBases.begin());
+            if (uBlock == m_lstBases.size() && m_uSize % s_uBlockSize != 0 && m_arTail[0] < Value) {
+                ++uBlock;
+            }
+            if (uBlock == 0) {
+                return begin();
+            }
+
+            CIterator it{this, (uBlock - 1) * s_uBlockSize};
+            size_t uCount = std::min(s_uBlockSize, m_uSize - it.m_uIndex);
+            const t_tType *pValues = it.Values();
+            size_t uPosition = static_cast<size_t>(std::lower_bound(pValues, pValues + uCount, Value) - pValues);
+            if (uPosition == uCount) {
+                return {this, it.m_uIndex + uCount};
+            }
+            it.m_uIndex += uPosition;
+            return it;
+        }
+
+        bool contains(t_tType Value) const {
+            auto it = lower_bound(Value);
+            return it != end() && *it == Value;
+        }
+
+        void clear() {
+            m_lstBases.clear();
+            m_lstBlocks.clear();
+            m_lstWords.clear();
+            m_lstPositions.clear();
+            m_lstExceptions.clear();
+            m_uSize = 0;
+        }
+
+    protected:
+        // First value of each compressed block, searched by lower_bound()
+        CList<t_tType, Growth::CAmortized> m_lstBases{};
+        CList<CBlock, Growth::CAmortized> m_lstBlocks{};
+        CList<t_tType, Growth::CAmortized> m_lstWords{};
+        // Position in the block and high bits of the exceptions
+        CList<uint8_t, Growth::CAmortized> m_lstPositions{};
+        CList<t_tType, Growth::CAmortized> m_lstExceptions{};
+        std::array<t_tType, s_uBlockSize> m_arTail{};
+        size_t m_uSize{0};
+        t_tType m_uBack{0};
+
+        /**
+         * Compresses the full tail into a block.
+         */
+        void Compress() {
+            std::array<t_tType, s_uBlockSize> arDeltas{};
+            std::array<size_t, s_uWordBits + 1> arWidths{};
+            for (size_t i = 0; i < s_uBlockSize; ++i) {
+                arDeltas[i] = m_arTail[i] - (i < s_uLanes ? m_arTail[0] : m_arTail[i - s_uLanes]);
+                ++arWidths[static_cast<size_t>(std::bit_width(arDeltas[i]))];
+            }
+
+            // Width minimising the packed bits plus a byte and a word per exception
+            size_t uBits = s_uWordBits;
+            size_t uBestCost = s_uBlockSize * s_uWordBits;
+            size_t uExceptions = 0;
+            for (size_t b = s_uWordBits; b-- > 0;) {
+                uExceptions += arWidths[b + 1];
+                size_t uCost = s_uBlockSize * b + uExceptions * (8 + s_uWordBits);
+                if (uCost < uBestCost) {
+                    uBestCost = uCost;
+                    uBits = b;
+                }
+            }
+
+            CBlock Block{m_lstWords.size(), static_cast<uint32_t>(m_lstExceptions.size()), 0,
+                         static_cast<uint8_t>(uBits)};
+            // At most 128 words, the widest values take a word per value
+            constexpr std::array<t_tType, s_uBlockSize> arZeros{};
+            m_lstWords.insert(m_lstWords.size(), arZeros.begin(), arZeros.begin() + uBits * s_uLanes);
+            t_tType *pWords = m_lstWords.data() + Block.m_uOffset;
+            for (size_t i = 0; i < s_uBlockSize; ++i) {
+                if (uBits < s_uWordBits && static_cast<size_t>(std::bit_width(arDeltas[i])) > uBits) {
+                    m_lstPositions.insert(static_cast<uint8_t>(i));
+                    m_lstExceptions.insert(static_cast<t_tType>(arDeltas[i] >> uBits));
+                    ++Block.m_uExceptions;
+                }
+                if (uBits == 0) {
+                    continue;
+                }
+                size_t uRow = i / s_uLanes;
+                size_t uLane = i % s_uLanes;
+                size_t uWord = uRow * uBits / s_uWordBits;
+                size_t uShift = uRow * uBits % s_uWordBits;
+                t_tType Low = uBits == s_uWordBits ? arDeltas[i] : arDeltas[i] & ((t_tType{1} << uBits) - 1);
+                pWords[uWord * s_uLanes + uLane] |= Low << uShift;
+                if (uShift + uBits > s_uWordBits) {
+                    pWords[(uWord + 1) * s_uLanes + uLane] |= Low >> (s_uWordBits - uShift);
+                }
+            }
+            m_lstBases.insert(m_arTail[0]);
+            m_lstBlocks.insert(Block);
+        }
+    };
+
+    static_assert(std::forward_iterator<CCompressedList<uint32_t>::CIterator>);
+    static_assert(std::ranges::forward_range<CCompressedList<uint64_t>>);
+}
@@ -0,0 +1,414 @@
+/**
+ * @file FlatMap.hpp
+ * @brief Sorted set and map stored in lists, searched without branches.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "List.hpp"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * Orders of the keys of the flat containers.
+ */
+namespace eho::Layout {
+    /**
+     * Ascending keys, binary searched. Keys can be inserted and erased, shifting the following ones.
+     */
+    struct CSorted {
+    };
+
+    /**
+     * Keys in the breadth first order of a complete binary search tree, the children of the slot k are
+     * the slots 2k + 1 and 2k + 2. The first levels stay in the cache and the search prefetches the cache
+     * line of its descendants a few levels ahead. The keys are built once and iterated in that order.
+     */
+    struct CEytzinger {
+    };
+
+    template<typename t_tLayout>
+    concept FlatLayout = std::same_as<t_tLayout, CSorted> || std::same_as<t_tLayout, CEytzinger>;
+}
+
+namespace eho::Internal {
+    /**
+     * Keys column shared by the flat set and map, and the searches over it.
+     * @tparam t_tLayout Layout::CSorted or Layout::CEytzinger.
+     */
+    template<typename t_tKey, Layout::FlatLayout t_tLayout, typename t_tCompare>
+    class CFlatIndex {
+    protected:
+        using Keys = CList<t_tKey, Growth::CAmortized>;
+        static constexpr bool s_bSorted = std::is_same_v<t_tLayout, Layout::CSorted>;
+
+    public:
+        using ConstIterator = typename Internal::CContainer<t_tKey, 0, false, Growth::CAmortized>::ConstIterator;
+
+        size_t size() const {
+            return m_lstKeys.size();
+        }
+
+        bool empty() const {
+            return m_lstKeys.empty();
+        }
+
+        /**
+         * The keys in the order of the layout.
+         */
+        const Keys &keys() const {
+            return m_lstKeys;
+        }
+
+        bool contains(const t_tKey &Key) const {
+            return IndexOf(Key) != m_lstKeys.size();
+        }
+
+    protected:
+        Keys m_lstKeys{};
+        [[no_unique_address]] t_tCompare m_Compare{};
+
+        /**
+         * Slot of the first key not ordered before Key, or size() if there is none.
+         */
+        size_t LowerBound(const t_tKey &Key) const {
+            if constexpr (s_bSorted) {
+                return SortedLowerBound(Key);
+            } else {
+                return EytzingerLowerBound(Key);
+            }
+        }
+
+        /**
+         * Slot of Key, or size() if it is missing.
+         */
+        size_t IndexOf(const t_tKey &Key) const {
+            size_t uIndex = LowerBound(Key);
+            if (uIndex != m_lstKeys.size() && m_Compare(Key, m_lstKeys.data()[uIndex])) {
+                return m_lstKeys.size();
+            }
+            return uIndex;
+        }
+
+        /**
+         * The comparison moves the base by a multiplication instead of a branch, the compilers turn a ternary
+         * into a jump. The middle keys of both halves are prefetched while the current one is compared.
+         */
+        size_t SortedLowerBound(const t_tKey &Key) const {
+            const t_tKey *pData = m_lstKeys.data();
+            const t_tKey *pBase = pData;
+            size_t uCount = m_lstKeys.size();
+            while (uCount > 1) {
+                size_t uHalf = uCount / 2;
+                Prefetch(pBase + uHalf / 2);
+                Prefetch(pBase + uHalf + uHalf / 2);
+                pBase += static_cast<size_t>(m_Compare(pBase[uHalf - 1], Key)) * uHalf;
+                uCount -= uHalf;
+            }
+            return static_cast<size_t>(pBase - pData) + (uCount == 1 && m_Compare(*pBase, Key));
+        }
+
+        /**
+         * Walks down the tree with the 1-based slot k, going right when the key is ordered before Key.
+         * The lower bound is the last node where the walk went left: the trailing ones of k are the right
+         * turns taken after it.
+         */
+        size_t EytzingerLowerBound(const t_tKey &Key) const {
+            // The descendants 4 levels down are 16 consecutive slots, a cache line of 4 byte keys
+            constexpr size_t uPrefetchScale = std::max<size_t>(2, std::bit_floor(s_uCacheLineSize / sizeof(t_tKey)));
+            const t_tKey *pData = m_lstKeys.data();
+            size_t uSize = m_lstKeys.size();
+            size_t k = 1;
+            while (k <= uSize) {
+                Prefetch(pData + std::min(k * uPrefetchScale, uSize) - 1);
+                k = 2 * k + static_cast<size_t>(m_Compare(pData[k - 1], Key));
+            }
+            k >>= std::countr_one(k) + 1;
+            return k == 0 ? uSize : k - 1;
+        }
+
+        /**
+         * Calls Place(uSlot, uRank) for the uSize keys in ascending order, with the slot of each in the layout.
+         */
+        template<typename t_tPlace>
+        static void ForEachSlot(size_t uSize, t_tPlace Place) {
+            if constexpr (s_bSorted) {
+                for (size_t i = 0; i < uSize; ++i) {
+                    Place(i, i);
+                }
+            } else {
+                // In order walk of the tree, the left subtrees first
+                size_t uRank = 0;
+                std::vector<size_t> vecStack{};
+                size_t k = 1;
+                while (k <= uSize || !vecStack.empty()) {
+                    for (; k <= uSize; k = 2 * k) {
+                        vecStack.push_back(k);
+                    }
+                    k = vecStack.back();
+                    vecStack.pop_back();
+                    Place(k - 1, uRank++);
+                    k = 2 * k + 1;
+                }
+            }
+        }
+
+        /**
+         * Sorts vecItems once by Key(Item), keeps the first of equivalent keys and lays them out.
+         * Append(Item) is called in slot order.
+         */
+        template<typename t_tItem, typename t_tGetKey, typename t_tAppend>
+        void Build(std::vector<t_tItem> &vecItems, t_tGetKey GetKey, t_tAppend Append) {
+            std::ranges::stable_sort(vecItems, m_Compare, GetKey);
+            auto Duplicates = std::ranges::unique(vecItems, [&](const t_tKey &Left, const t_tKey &Right) {
+                return !m_Compare(Left, Right);
+            }, GetKey);
+            vecItems.erase(Duplicates.begin(), Duplicates.end());
+
+            std::vector<size_t> vecRanks(vecItems.size());
+            ForEachSlot(vecItems.size(), [&](size_t uSlot, size_t uRank) { vecRanks[uSlot] = uRank; });
+            m_lstKeys.clear();
+            m_lstKeys.resize(vecItems.size());
+            for (size_t uRank: vecRanks) {
+                Append(vecItems[uRank]);
+            }
+        }
+    };
+}
+
+namespace eho {
+    /**
+     * Set of unique keys stored in a list, see Layout for the order of the keys.
+     * Faster to search than a std::set for lookup tables built once, as the keys are contiguous.
+     * @tparam t_tLayout Layout::CSorted keeps the keys ascending and allows insertions and removals,
+     * Layout::CEytzinger is built once and searched faster on large sets.
+     */
+    template<typename t_tKey, Layout::FlatLayout t_tLayout = Layout::CSorted, typename t_tCompare = std::less<t_tKey>>
+    requires std::strict_weak_order<t_tCompare, const t_tKey &, const t_tKey &>
+    class CFlatSet : public Internal::CFlatIndex<t_tKey, t_tLayout, t_tCompare> {
+    protected:
+        using Base = Internal::CFlatIndex<t_tKey, t_tLayout, t_tCompare>;
+
+    public:
+        using ConstIterator = typename Base::ConstIterator;
+
+        CFlatSet() = default;
+
+        /**
+         * Set of the keys of Range in any order, sorted once. Duplicated keys are kept once.
+         */
+        template<std::ranges::input_range t_tRange>
+        requires std::convertible_to<std::ranges::range_reference_t<t_tRange>, t_tKey>
+        explicit CFlatSet(t_tRange &&Range) {
+            std::vector<t_tKey> vecKeys(std::ranges::begin(Range), std::ranges::end(Range));
+            Base::Build(vecKeys, std::identity{}, [&](t_tKey &Key) { Base::m_lstKeys.insert(std::move(Key)); });
+        }
+
+        CFlatSet(std::initializer_list<t_tKey> lstKeys) : CFlatSet(std::span{lstKeys.begin(), lstKeys.size()}) {}
+
+        ConstIterator begin() const {
+            return Base::m_lstKeys.begin();
+        }
+
+        ConstIterator end() const {
+            return Base::m_lstKeys.end();
+        }
+
+        /**
+         * Key equivalent to Key, or end().
+         */
+        ConstIterator find(const t_tKey &Key) const {
+            return begin() + static_cast<std::ptrdiff_t>(Base::IndexOf(Key));
+        }
+
+        /**
+         * First key not ordered before Key, or end().
+         */
+        ConstIterator lower_bound(const t_tKey &Key) const {
+            return begin() + static_cast<std::ptrdiff_t>(Base::LowerBound(Key));
+        }
+
+        /**
+         * @return If Key was missing and has been inserted.
+         */
+        bool insert(const t_tKey &Key) requires Base::s_bSorted {
+            size_t uIndex = Base::LowerBound(Key);
+            if (uIndex != Base::size() && !Base::m_Compare(Key, Base::m_lstKeys[uIndex])) {
+                return false;
+            }
+            Base::m_lstKeys.insert(uIndex, Key);
+            return true;
+        }
+
+        /**
+         * @return If Key was present and has been removed.
+         */
+        bool erase(const t_tKey &Key) requires Base::s_bSorted {
+            size_t uIndex = Base::IndexOf(Key);
+            if (uIndex == Base::size()) {
+                return false;
+            }
+            Base::m_lstKeys.erase(uIndex, uIndex + 1);
+            return true;
+        }
+
+        void clear() {
+            Base::m_lstKeys.clear();
+        }
+    };
+
+    /**
+     * Map of unique keys stored in two lists, a keys column and a values column in the same order.
+     * The searches only touch the keys, see Layout for their order.
+     * @tparam t_tLayout Layout::CSorted keeps the keys ascending and allows insertions and removals,
+     * Layout::CEytzinger is built once and searched faster on large maps.
+     */
+    template<typename t_tKey, typename t_tValue, Layout::FlatLayout t_tLayout = Layout::CSorted,
+            typename t_tCompare = std::less<t_tKey>>
+    requires std::strict_weak_order<t_tCompare, const t_tKey &, const t_tKey &>
+    class CFlatMap : public Internal::CFlatIndex<t_tKey, t_tLayout, t_tCompare> {
+    protected:
+        using Base = Internal::CFlatIndex<t_tKey, t_tLayout, t_tCompare>;
+        using Values = CList<t_tValue, Growth::CAmortized>;
+
+    public:
+        CFlatMap() = default;
+
+        /**
+         * Map of the key and value pairs of Range in any order, sorted once.
+         * The first value of a duplicated key is kept.
+         */
+        template<std::ranges::input_range t_tRange>
+        requires std::convertible_to<std::ranges::range_reference_t<t_tRange>, std::pair<t_tKey, t_tValue>>
+        explicit CFlatMap(t_tRange &&Range) {
+            std::vector<std::pair<t_tKey, t_tValue>> vecItems(std::ranges::begin(Range), std::ranges::end(Range));
+            m_lstValues.resize(vecItems.size());
+            Base::Build(vecItems, &std::pair<t_tKey, t_tValue>::first, [&](std::pair<t_tKey, t_tValue> &Item) {
+                Base::m_lstKeys.insert(std::move(Item.first));
+                m_lstValues.insert(std::move(Item.second));
+            });
+        }
+
+        CFlatMap(std::initializer_list<std::pair<t_tKey, t_tValue>> lstItems) :
+                CFlatMap(std::span{lstItems.begin(), lstItems.size()}) {}
+
+        /**
+         * The values in the order of keys().
+         */
+        const Values &values() const {
+            return m_lstValues;
+        }
+
+        /**
+         * Mutable values, a span so their amount always matches the keys.
+         */
+        std::span<t_tValue> values() {
+            return {m_lstValues.data(), m_lstValues.size()};
+        }
+
+        /**
+         * Value of Key, or nullptr if it is missing.
+         */
+        t_tValue *find(const t_tKey &Key) {
+            size_t uIndex = Base::IndexOf(Key);
+            return uIndex == Base::size() ? nullptr : &m_lstValues[uIndex];
+        }
+
+        const t_tValue *find(const t_tKey &Key) const {
+            size_t uIndex = Base::IndexOf(Key);
+            return uIndex == Base::size() ? nullptr : &m_lstValues[uIndex];
+        }
+
+        t_tValue &at(const t_tKey &Key) {
+            return const_cast<t_tValue &>(std::as_const(*this).at(Key));
+        }
+
+        const t_tValue &at(const t_tKey &Key) const {
+            const t_tValue *pValue = find(Key);
+            if (pValue == nullptr) {
+                throw std::out_of_range{"Requested key is missing"};
+            }
+
+            return *pValue;
+        }
+
+        /**
+         * Index in keys() and values() of the first key not ordered before Key, or size().
+         */
+        size_t lower_bound(const t_tKey &Key) const {
+            return Base::LowerBound(Key);
+        }
+
+        /**
+         * Inserts Key with Value, an existing key keeps its value.
+         * @return If Key was missing and has been inserted.
+         */
+        bool insert(const t_tKey &Key, const t_tValue &Value) requires Base::s_bSorted {
+            size_t uIndex = Base::LowerBound(Key);
+            if (uIndex != Base::size() && !Base::m_Compare(Key, Base::m_lstKeys[uIndex])) {
+                return false;
+            }
+            Base::m_lstKeys.insert(uIndex, Key);
+            try {
+                m_lstValues.insert(uIndex, Value);
+            } catch (...) {
+                Base::m_lstKeys.erase(uIndex, uIndex + 1);
+                throw;
+            }
+            return true;
+        }
+
+        /**
+         * Value of Key, inserted value initialized if it is missing.
+         */
+        t_tValue &operator[](const t_tKey &Key) requires Base::s_bSorted && std::default_initializable<t_tValue> {
+            size_t uIndex = Base::LowerBound(Key);
+            if (uIndex == Base::size() || Base::m_Compare(Key, Base::m_lstKeys[uIndex])) {
+                Base::m_lstKeys.insert(uIndex, Key);
+                try {
+                    m_lstValues.emplace(uIndex);
+                } catch (...) {
+                    Base::m_lstKeys.erase(uIndex, uIndex + 1);
+                    throw;
+                }
+            }
+            return m_lstValues[uIndex];
+        }
+
+        /**
+         * @return If Key was present and has been removed.
+         */
+        bool erase(const t_tKey &Key) requires Base::s_bSorted {
+            size_t uIndex = Base::IndexOf(Key);
+            if (uIndex == Base::size()) {
+                return false;
+            }
+            Base::m_lstKeys.erase(uIndex, uIndex + 1);
+            m_lstValues.erase(uIndex, uIndex + 1);
+            return true;
+        }
+
+        void clear() {
+            Base::m_lstKeys.clear();
+            m_lstValues.clear();
+        }
+
+    protected:
+        Values m_lstValues{};
+    };
+}
@@ -0,0 +1,177 @@
+/**
+ * @file GrowthPolicy.hpp
+ * @brief Capacity growth and shrink policies for the dynamic containers.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+
+namespace eho::Growth {
+    /**
+     * A growth policy decides the capacity of a dynamic container.
+     * <br/><br/>
+     * Grow(uCapacity, uRequired, uElementSize) is called when an insertion needs more than uCapacity elements
+     * and must return a capacity >= uRequired.
+     * <br/><br/>
+     * Shrink(uCapacity, uSize, uElementSize) is called after a removal and returns the new capacity,
+     * returning uCapacity keeps the current allocation.
+     */
+    template<typename t_tPolicy>
+    concept GrowthPolicy = requires(size_t uValue) {
+        { t_tPolicy::Grow(uValue, uValue, uValue) } -> std::same_as<size_t>;
+        { t_tPolicy::Shrink(uValue, uValue, uValue) } -> std::same_as<size_t>;
+    };
+
+    /**
+     * Shrink hysteresis shared by the policies.
+     * The storage is only shrunk once the container uses at most 1/t_uShrinkRatio of its capacity,
+     * so removals followed by insertions around the same size never reallocate.
+     * Capacities up to t_uShrinkRatio elements are never shrunk, t_uShrinkRatio = 0 disables shrinking.
+     */
+    template<size_t t_uShrinkRatio>
+    struct CShrinkRatio {
+        static constexpr bool ShouldShrink(size_t uCapacity, size_t uSize) {
+            return t_uShrinkRatio != 0 && uCapacity > t_uShrinkRatio && uSize * t_uShrinkRatio <= uCapacity;
+        }
+    };
+
+    /**
+     * Grows to exactly the required capacity.
+     */
+    template<size_t t_uShrinkRatio = 4>
+    struct CExact : CShrinkRatio<t_uShrinkRatio> {
+        static constexpr size_t Grow(size_t, size_t uRequired, size_t) {
+            return uRequired;
+        }
+
+        static constexpr size_t Shrink(size_t uCapacity, size_t uSize, size_t) {
+            return CExact::ShouldShrink(uCapacity, uSize) ? uSize : uCapacity;
+        }
+    };
+
+    /**
+     * Grows geometrically by t_uNumerator/t_uDenominator.
+     */
+    template<size_t t_uNumerator, size_t t_uDenominator, size_t t_uShrinkRatio = 4>
+    requires(t_uNumerator > t_uDenominator && t_uDenominator > 0)
+    struct CFactor : CShrinkRatio<t_uShrinkRatio> {
+        static constexpr size_t Grow(size_t uCapacity, size_t uRequired, size_t) {
+            return std::max(uRequired, uCapacity * t_uNumerator / t_uDenominator);
+        }
+
+        static constexpr size_t Shrink(size_t uCapacity, size_t uSize, size_t) {
+            return CFactor::ShouldShrink(uCapacity, uSize) ? uSize * t_uNumerator / t_uDenominator : uCapacity;
+        }
+    };
+
+    /**
+     * Grows to the next power of two.
+     */
+    template<size_t t_uShrinkRatio = 4>
+    struct CPowerOfTwo : CShrinkRatio<t_uShrinkRatio> {
+        static constexpr size_t Grow(size_t, size_t uRequired, size_t) {
+            return std::bit_ceil(uRequired);
+        }
+
+        static constexpr size_t Shrink(size_t uCapacity, size_t uSize, size_t) {
+            if (!CPowerOfTwo::ShouldShrink(uCapacity, uSize)) {
+                return uCapacity;
+            }
+            return uSize == 0 ? 0 : std::bit_ceil(uSize);
+        }
+    };
+
+    /**
+     * Rounds the capacity chosen by t_tBase up to whole pages of t_uPageSize bytes.
+     */
+    template<GrowthPolicy t_tBase, size_t t_uPageSize = 4096>
+    requires(std::has_single_bit(t_uPageSize))
+    struct CPageGranular {
+        static constexpr size_t Grow(size_t uCapacity, size_t uRequired, size_t uElementSize) {
+            return RoundToPage(t_tBase::Grow(uCapacity, uRequired, uElementSize), uElementSize);
+        }
+
+        static constexpr size_t Shrink(size_t uCapacity, size_t uSize, size_t uElementSize) {
+            size_t uNewCapacity = t_tBase::Shrink(uCapacity, uSize, uElementSize);
+            if (uNewCapacity == uCapacity) {
+                return uCapacity;
+            }
+            return std::min(uCapacity, RoundToPage(uNewCapacity, uElementSize));
+        }
+
+    private:
+        static constexpr size_t RoundToPage(size_t uCapacity, size_t uElementSize) {
+            size_t uBytes = (uCapacity * uElementSize + t_uPageSize - 1) & ~(t_uPageSize - 1);
+            return uBytes / uElementSize;
+        }
+    };
+
+    /**
+     * Never grows nor shrinks, the capacity is fixed.
+     * Selects the allocation free container for the lists with an inline capacity, see CListInplace.
+     */
+    struct CFixed {
+        static constexpr size_t Grow(size_t uCapacity, size_t uRequired, size_t) {
+            if (uRequired > uCapacity) {
+                throw std::length_error{"The capacity is fixed"};
+            }
+            return uCapacity;
+        }
+
+        static constexpr size_t Shrink(size_t uCapacity, size_t, size_t) {
+            return uCapacity;
+        }
+    };
+
+    /**
+     * Grows by whole blocks of t_uBlockSize bytes that are never moved, keeps one spare block on removals.
+     * Selects the segmented container, see CListSegmented.
+     */
+    template<size_t t_uBlockSize = 4096>
+    requires(std::has_single_bit(t_uBlockSize))
+    struct CSegmented {
+        /**
+         * Elements per block, a power of two so the indexing is a shift and a mask.
+         */
+        static constexpr size_t BlockCapacity(size_t uElementSize) {
+            return uElementSize >= t_uBlockSize ? 1 : std::bit_floor(t_uBlockSize / uElementSize);
+        }
+
+        static constexpr size_t Grow(size_t, size_t uRequired, size_t uElementSize) {
+            size_t uBlock = BlockCapacity(uElementSize);
+            return (uRequired + uBlock - 1) / uBlock * uBlock;
+        }
+
+        static constexpr size_t Shrink(size_t uCapacity, size_t uSize, size_t uElementSize) {
+            return std::min(uCapacity, Grow(uCapacity, uSize + BlockCapacity(uElementSize), uElementSize));
+        }
+    };
+
+    /**
+     * Grows by 1.5x, what the lists used to call amortized.
+     */
+    using CAmortized = CFactor<3, 2>;
+
+    using CDouble = CFactor<2, 1>;
+
+    static_assert(GrowthPolicy<CExact<>>);
+    static_assert(GrowthPolicy<CAmortized>);
+    static_assert(GrowthPolicy<CDouble>);
+    static_assert(GrowthPolicy<CPowerOfTwo<>>);
+    static_assert(GrowthPolicy<CPageGranular<CAmortized>>);
+    static_assert(GrowthPolicy<CFixed>);
+    static_assert(GrowthPolicy<CSegmented<>>);
+}
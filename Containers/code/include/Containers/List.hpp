@@ -14,14 +14,26 @@
 #pragma once
 
 #include "Storage.hpp"
+#include "AlignedAllocator.hpp"
+#include "MappedAllocator.hpp"
 #include <optional>
 #include <exception>
+#include <initializer_list>
+#include <memory_resource>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
 
 namespace eho {
-    template<typename t_tType>
+    /**
+     * Read only view of a list.
+     * @tparam t_tType List's data type.
+     * @tparam t_tConstIterator Iterator returned by begin() and end(), contiguous unless the list is linked.
+     */
+    template<typename t_tType, typename t_tConstIterator = Internal::CIterator<const t_tType>>
     class IListView {
     protected:
-        using ConstIterator = Internal::CIterator<const t_tType>;
+        using ConstIterator = t_tConstIterator;
 
     public:
 
@@ -38,61 +50,69 @@ namespace eho {
         virtual ConstIterator end() const = 0;
     };
 
-    template<typename t_tType, size_t t_uSize, bool t_bLinked, bool t_bAmortized>
-    class CBaseListImplementation : IListView<t_tType> {
+    template<typename t_tType, size_t t_uSize, bool t_bLinked, typename t_tGrowth,
+            typename t_tAllocator = std::allocator<t_tType>>
+    class CBaseListImplementation : public IListView<t_tType, typename Internal::CContainer<
+            t_tType, t_uSize, t_bLinked, t_tGrowth, t_tAllocator>::ConstIterator> {
     protected:
-        using ConstIterator = IListView<t_tType>::ConstIterator;
-        using Iterator = Internal::CIterator<t_tType>;
+        using Container = Internal::CContainer<t_tType, t_uSize, t_bLinked, t_tGrowth, t_tAllocator>;
+        using ConstIterator = Container::ConstIterator;
+        using Iterator = Container::Iterator;
 
     public:
-        const t_tType &at(size_t uIndex) const override {
+        constexpr CBaseListImplementation() = default;
+
+        explicit CBaseListImplementation(const t_tAllocator &Allocator)
+        requires std::constructible_from<Container, const t_tAllocator &>: m_Storage{Allocator} {}
+
+        constexpr const t_tType &at(size_t uIndex) const override {
             return InnerAt(uIndex);
         }
 
-        virtual t_tType &at(size_t uIndex) {
+        constexpr virtual t_tType &at(size_t uIndex) {
             return InnerAt(uIndex);
         }
 
-        const t_tType &operator[](size_t uIndex) const override {
+        constexpr const t_tType &operator[](size_t uIndex) const override {
             return InnerAt(uIndex);
         }
 
-        virtual t_tType &operator[](size_t uIndex) {
+        constexpr virtual t_tType &operator[](size_t uIndex) {
             return InnerAt(uIndex);
         }
 
-        size_t size() const override {
+        constexpr size_t size() const override {
             return m_Storage.size();
         }
 
-        bool empty() const override {
+        constexpr bool empty() const override {
             return m_Storage.size() == 0;
         }
 
-        t_tType *data() { return m_Storage.data(); }
+        constexpr t_tType *data() { return m_Storage.data(); }
 
-        const t_tType *data() const { return m_Storage.data(); }
+        constexpr const t_tType *data() const { return m_Storage.data(); }
 
-        Iterator begin() {
+        constexpr Iterator begin() {
             return m_Storage.begin();
         }
 
-        virtual Iterator end() {
+        constexpr virtual Iterator end() {
             return m_Storage.end();
         }
 
-        ConstIterator begin() const override {
+        constexpr ConstIterator begin() const override {
             return m_Storage.begin();
         }
 
-        ConstIterator end() const override {
+        constexpr ConstIterator end() const override {
             return m_Storage.end();
         }
 
     protected:
-        Internal::CContainer<t_tType, t_uSize, t_bLinked, t_bAmortized> m_Storage;
+        Container m_Storage;
 
-        virtual inline t_tType &InnerAt(size_t uIndex) {
+        constexpr virtual inline t_tType &InnerAt(size_t uIndex) {
             if (uIndex >= m_Storage.size()) {
                 throw std::out_of_range{"Requested index is out of range"};
             }
@@ -100,7 +120,7 @@ namespace eho {
             return m_Storage[uIndex];
         }
 
-        virtual inline const t_tType &InnerAt(size_t uIndex) const {
+        constexpr virtual inline const t_tType &InnerAt(size_t uIndex) const {
             if (uIndex >= m_Storage.size()) {
                 throw std::out_of_range{"Requested index is out of range"};
             }
@@ -109,22 +129,56 @@ namespace eho {
         }
     };
 
-    template<typename t_tType, bool t_bLinked, bool t_bAmortized>
-    class CDynamicListImplementation : public CBaseListImplementation<t_tType, 0, t_bLinked, t_bAmortized> {
+    template<typename t_tType, size_t t_uSize, bool t_bLinked, Growth::GrowthPolicy t_tGrowth,
+            typename t_tAllocator = std::allocator<t_tType>>
+    class CDynamicListImplementation :
+            public CBaseListImplementation<t_tType, t_uSize, t_bLinked, t_tGrowth, t_tAllocator> {
     protected:
-        using Base = CBaseListImplementation<t_tType, 0, t_bLinked, t_bAmortized>;
+        using Base = CBaseListImplementation<t_tType, t_uSize, t_bLinked, t_tGrowth, t_tAllocator>;
 
     public:
-        size_t size() const override {
-            return m_uUsedSize;
+        using allocator_type = t_tAllocator;
+
+        constexpr CDynamicListImplementation() = default;
+
+        /**
+         * Empty list allocating from Allocator, e.g. a std::pmr::polymorphic_allocator of an arena.
+         */
+        explicit CDynamicListImplementation(const t_tAllocator &Allocator)
+        requires std::constructible_from<typename Base::Container, const t_tAllocator &>: Base(Allocator) {}
+
+        constexpr size_t size() const override {
+            return Base::m_Storage.count();
         }
 
-        size_t capacity() const {
+        constexpr size_t capacity() const {
             return Base::m_Storage.size();
         }
 
-        bool empty() const override {
-            return m_uUsedSize == 0;
+        /**
+         * Alignment in bytes of data().
+         */
+        static constexpr size_t alignment() requires requires { Base::Container::s_uAlignment; } {
+            return Base::Container::s_uAlignment;
+        }
+
+        /**
+         * Amount of elements that can be read from data(), the buffer is padded to a whole multiple of alignment()
+         * bytes, so vector kernels can load the last block instead of running a scalar epilogue.
+         * The elements past size() are uninitialized and must not be written.
+         */
+        constexpr size_t padded_size() const requires requires { Base::Container::s_uAlignment; } {
+            return Internal::PaddedSize(Base::m_Storage.count(), sizeof(t_tType), alignment());
+        }
+
+        t_tAllocator get_allocator() const requires requires(const Base::Container &Storage) {
+            Storage.get_allocator();
+        } {
+            return Base::m_Storage.get_allocator();
+        }
+
+        constexpr bool empty() const override {
+            return Base::m_Storage.count() == 0;
         }
 
         /**
@@ -134,78 +188,173 @@ namespace eho {
          * <br/><br/>
          * If uNewSize > capacity(): It will reserve the memory,
          * size() will not be affected. Use insert() to update the values after size()-1.
-         * Will do nothing if t_bAmortized=false.
          * <br/><br/>
-         * If uNewSize < capacity(): size() will become uNewSize, the last elements
-         * of the list will be invalidated. Be aware that if t_bAmortized=true,
-         * capacity() will be kept as it is.
+         * If uNewSize < capacity(): The capacity is reduced and, if uNewSize < size(),
+         * size() will become uNewSize and the last elements of the list will be destroyed.
+         * <br/><br/>
+         * The growth policy is not applied, the new capacity is exactly uNewSize
+         * (rounded up to whole nodes for the linked list).
          * @param uNewSize The container's new capacity.
          */
-        void resize(size_t uNewSize) {
-            auto uUpdatedSize = Base::m_Storage.resize(uNewSize);
-            if (uNewSize < Base::m_Storage.size()) {
-                m_uUsedSize = uUpdatedSize;
-            }
+        constexpr void resize(size_t uNewSize) {
+            Base::m_Storage.resize(uNewSize);
+        }
+
+        constexpr void clear() {
+            Base::m_Storage.resize(0);
+        }
+
+        constexpr void insert(const t_tType &Item) {
+            this->insert(Base::m_Storage.count(), Item);
+        }
+
+        constexpr void insert(t_tType &&Item) {
+            this->insert(Base::m_Storage.count(), std::move(Item));
         }
 
-        void clear() {
-            m_uUsedSize = Base::m_Storage.resize(0);
+        constexpr void insert(size_t uIndex, const t_tType &Item) {
+            Base::m_Storage.insert(Item, uIndex, Base::m_Storage.count());
         }
 
-        void insert(const t_tType &Item) {
-            this->insert(m_uUsedSize, Item);
+        constexpr void insert(size_t uIndex, t_tType &&Item) {
+            Base::m_Storage.insert(std::move(Item), uIndex, Base::m_Storage.count());
         }
 
-        void insert(const t_tType &&Item) {
-            this->insert(m_uUsedSize, Item);
+        /**
+         * Constructs an element before uIndex directly in the storage.
+         * @return The new element.
+         */
+        template<typename... t_tArgs>
+        requires std::constructible_from<t_tType, t_tArgs...>
+        constexpr t_tType &emplace(size_t uIndex, t_tArgs &&... Args) {
+            if (uIndex > Base::m_Storage.count()) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            return Base::m_Storage.emplace(uIndex, Base::m_Storage.count(), std::forward<t_tArgs>(Args)...);
+        }
+
+        /**
+         * Constructs an element at the end of the list directly in the storage.
+         * @return The new element.
+         */
+        template<typename... t_tArgs>
+        requires std::constructible_from<t_tType, t_tArgs...>
+        constexpr t_tType &emplace_back(t_tArgs &&... Args) {
+            return this->emplace(Base::m_Storage.count(), std::forward<t_tArgs>(Args)...);
+        }
+
+        /**
+         * Inserts the elements of [First, Last) before uIndex.
+         * For forward iterators the storage grows at most once and the tail is shifted once.
+         */
+        template<std::input_iterator t_tIterator, std::sentinel_for<t_tIterator> t_tSentinel>
+        requires std::constructible_from<t_tType, std::iter_reference_t<t_tIterator>>
+        constexpr void insert(size_t uIndex, t_tIterator First, t_tSentinel Last) {
+            if (uIndex > Base::m_Storage.count()) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            if constexpr (std::forward_iterator<t_tIterator>) {
+                auto uCount = static_cast<size_t>(std::ranges::distance(First, Last));
+                Base::m_Storage.insert(First, uCount, uIndex, Base::m_Storage.count());
+            } else {
+                // Single pass iterators, the amount of elements is unknown
+                for (; First != Last; ++First, ++uIndex) {
+                    Base::m_Storage.insert(t_tType(*First), uIndex, Base::m_Storage.count());
+                }
+            }
         }
 
-        void insert(size_t uIndex, const t_tType &Item) {
-            Base::m_Storage.insert(Item, uIndex, m_uUsedSize);
-            m_uUsedSize += 1;
+        constexpr void insert(size_t uIndex, std::initializer_list<t_tType> lstItems) {
+            this->insert(uIndex, lstItems.begin(), lstItems.end());
         }
 
-        void insert(size_t uIndex, t_tType &&Item) {
-            Base::m_Storage.insert(Item, uIndex, m_uUsedSize);
-            m_uUsedSize += 1;
+        /**
+         * Inserts the elements of Range at the end of the list.
+         */
+        template<std::ranges::input_range t_tRange>
+        requires std::constructible_from<t_tType, std::ranges::range_reference_t<t_tRange>>
+        constexpr void append_range(t_tRange &&Range) {
+            this->insert(Base::m_Storage.count(), std::ranges::begin(Range), std::ranges::end(Range));
         }
 
-        std::optional<t_tType> pop() {
-            size_t uIndex = m_uUsedSize == 0 ? 0 : m_uUsedSize - 1;
+        constexpr std::optional<t_tType> pop() {
+            size_t uIndex = Base::m_Storage.count() == 0 ? 0 : Base::m_Storage.count() - 1;
             return this->pop(uIndex);
         }
 
-        std::optional<t_tType> pop(size_t uIndex) {
+        constexpr std::optional<t_tType> pop(size_t uIndex) {
             std::optional<t_tType> RtnVal{};
-            if (uIndex < m_uUsedSize) {
-                RtnVal.emplace(std::move(Base::m_Storage.pop(uIndex, m_uUsedSize)));
-                m_uUsedSize -= 1;
+            if (uIndex < Base::m_Storage.count()) {
+                RtnVal.emplace(std::move(Base::m_Storage.pop(uIndex, Base::m_Storage.count())));
             }
 
             return RtnVal;
         }
 
-        Base::Iterator end() override {
-            return Base::m_Storage.begin() + m_uUsedSize;
+        /**
+         * Removes the elements in [uFirst, uLast), the tail is shifted once.
+         */
+        constexpr void erase(size_t uFirst, size_t uLast) {
+            if (uFirst > uLast || uLast > Base::m_Storage.count()) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            Base::m_Storage.erase(uFirst, uLast, Base::m_Storage.count());
         }
 
-        Base::ConstIterator end() const override {
-            return Base::m_Storage.begin() + m_uUsedSize;
+        /**
+         * Removes every element matching Predicate, compacting the list in a single pass.
+         * The order of the kept elements is preserved.
+         * @return The amount of removed elements.
+         */
+        template<std::predicate<const t_tType &> t_tPredicate>
+        constexpr size_t erase_if(t_tPredicate Predicate) {
+            size_t uRemoved = Base::m_Storage.erase_if(Predicate, Base::m_Storage.count());
+            return uRemoved;
         }
 
-    protected:
-        size_t m_uUsedSize = 0;
+        /**
+         * Removes the element uIndex without shifting the tail, the last element is moved into its place.
+         * The order of the elements is not preserved.
+         */
+        constexpr std::optional<t_tType> swap_remove(size_t uIndex) {
+            std::optional<t_tType> RtnVal{};
+            if (uIndex < Base::m_Storage.count()) {
+                RtnVal.emplace(Base::m_Storage.swap_remove(uIndex, Base::m_Storage.count()));
+            }
+
+            return RtnVal;
+        }
+
+        constexpr Base::Iterator end() override {
+            if constexpr (t_bLinked) {
+                return Base::m_Storage.end();
+            } else {
+                return Base::m_Storage.begin() + Base::m_Storage.count();
+            }
+        }
+
+        constexpr Base::ConstIterator end() const override {
+            if constexpr (t_bLinked) {
+                return Base::m_Storage.end();
+            } else {
+                return Base::m_Storage.begin() + Base::m_Storage.count();
+            }
+        }
 
-        inline t_tType &InnerAt(size_t uIndex) override {
-            if (uIndex >= m_uUsedSize) {
+    protected:
+        constexpr inline t_tType &InnerAt(size_t uIndex) override {
+            if (uIndex >= Base::m_Storage.count()) {
                 throw std::out_of_range{"Requested index is out of range"};
             }
 
             return Base::m_Storage[uIndex];
         }
 
-        inline const t_tType &InnerAt(size_t uIndex) const override {
-            if (uIndex >= m_uUsedSize) {
+        constexpr inline const t_tType &InnerAt(size_t uIndex) const override {
+            if (uIndex >= Base::m_Storage.count()) {
                 throw std::out_of_range{"Requested index is out of range"};
             }
 
@@ -215,21 +364,82 @@ namespace eho {
 
     /**
      * Dynamic allocated list.
+     * @tparam t_tGrowth Growth policy, see GrowthPolicy.hpp. Removals only shrink the
+     * capacity once the policy's shrink threshold is crossed.
+     * @tparam t_tAllocator Allocator of the storage, see eho::pmr for the polymorphic allocator lists.
      */
-    template<typename t_tType, bool t_bAmortized = false>
-    using CList = CDynamicListImplementation<t_tType, false, t_bAmortized>;
+    template<typename t_tType, Growth::GrowthPolicy t_tGrowth = Growth::CExact<>,
+            typename t_tAllocator = std::allocator<t_tType>>
+    using CList = CDynamicListImplementation<t_tType, 0, false, t_tGrowth, t_tAllocator>;
 
     /**
      * Static allocated list.
      */
     template<typename t_tType, size_t t_uSize>
-    using CListStatic = CBaseListImplementation<t_tType, t_uSize, false, false>;
+    using CListStatic = CBaseListImplementation<t_tType, t_uSize, false, void>;
 
     /**
      * Dynamic allocated linked list.
+     * Unrolled, each node holds a cache line of elements. Iterators are bidirectional and
+     * indexed access walks the nodes.
      */
-    template<typename t_tType, bool t_bAmortized = false>
-    using CListLinked = CDynamicListImplementation<t_tType, true, t_bAmortized>;
+    template<typename t_tType, Growth::GrowthPolicy t_tGrowth = Growth::CExact<>,
+            typename t_tAllocator = std::allocator<t_tType>>
+    using CListLinked = CDynamicListImplementation<t_tType, 0, true, t_tGrowth, t_tAllocator>;
+
+    /**
+     * Dynamic list stored in blocks of t_uBlockSize bytes found through a block table.
+     * Growing allocates a block and never moves the elements, pointers to them stay valid while elements
+     * are appended or removed from the end. Iterators are random access.
+     * @tparam t_uBlockSize Size of the blocks in bytes, holding a power of two of elements.
+     */
+    template<typename t_tType, size_t t_uBlockSize = 4096, typename t_tAllocator = std::allocator<t_tType>>
+    using CListSegmented = CDynamicListImplementation<t_tType, 0, false, Growth::CSegmented<t_uBlockSize>,
+            t_tAllocator>;
+
+    /**
+     * Dynamic list for hundreds of millions of elements.
+     * The storage is an anonymous memory mapping backed by transparent huge pages, the growth remaps it
+     * without copying trivially relocatable elements. The default policy grows by 1.5x in whole huge pages.
+     */
+    template<typename t_tType,
+            Growth::GrowthPolicy t_tGrowth = Growth::CPageGranular<Growth::CAmortized, size_t{2} << 20>>
+    using CListHuge = CList<t_tType, t_tGrowth, CMappedAllocator<t_tType>>;
+
+    /**
+     * Dynamic list whose buffer is aligned to t_uAlignment bytes and padded to a whole multiple of it,
+     * see alignment() and padded_size().
+     * @tparam t_uAlignment Alignment of data(), e.g. 32 for AVX or 64 for AVX-512.
+     */
+    template<typename t_tType, size_t t_uAlignment = Internal::s_uCacheLineSize,
+            Growth::GrowthPolicy t_tGrowth = Growth::CExact<>>
+    using CListAligned = CList<t_tType, t_tGrowth, CAlignedAllocator<t_tType, t_uAlignment>>;
+
+    /**
+     * Dynamic list with small buffer optimization.
+     * The first t_uSize elements live inside the object, the list only allocates once it grows past them.
+     */
+    template<typename t_tType, size_t t_uSize, Growth::GrowthPolicy t_tGrowth = Growth::CExact<>,
+            typename t_tAllocator = std::allocator<t_tType>>
+    requires(t_uSize > 0)
+    using CListSmall = CDynamicListImplementation<t_tType, t_uSize, false, t_tGrowth, t_tAllocator>;
+
+    /**
+     * Fixed capacity list, the t_uSize elements are stored inside the object and never allocated.
+     * Unlike CListStatic the size is tracked and the elements are only constructed on insertion.
+     * Inserting into a full list throws std::length_error. Usable in constant expressions.
+     */
+    template<typename t_tType, size_t t_uSize>
+    requires(t_uSize > 0)
+    using CListInplace = CDynamicListImplementation<t_tType, t_uSize, false, Growth::CFixed>;
+
+    /**
+     * The heap backed lists only hold pointers to their storage, tables of lists can relocate them with memcpy.
+     */
+    template<typename t_tType, bool t_bLinked, typename t_tGrowth, typename t_tAllocator>
+    struct is_trivially_relocatable<CDynamicListImplementation<t_tType, 0, t_bLinked, t_tGrowth, t_tAllocator>> :
+            is_trivially_relocatable<t_tAllocator> {
+    };
 
     /**
      * Static asserts for the lists' iterators
@@ -239,9 +449,55 @@ namespace eho {
     // Dynamic array
     static_assert(std::ranges::contiguous_range<CList<int>>);
     // Dynamic amortized array
-    static_assert(std::ranges::contiguous_range<CList<int, true>>);
+    static_assert(std::ranges::contiguous_range<CList<int, Growth::CAmortized>>);
     // Linked list
-//    static_assert(std::ranges::contiguous_range<CListLinked<int>>);
+    static_assert(std::ranges::bidirectional_range<CListLinked<int>>);
     // Linked list amortized
-//    static_assert(std::ranges::contiguous_range<CListLinked<int, true>>);
+    static_assert(std::ranges::bidirectional_range<CListLinked<int, Growth::CAmortized>>);
+    // Aligned array
+    static_assert(std::ranges::contiguous_range<CListAligned<float>>);
+    // Segmented array
+    static_assert(std::ranges::random_access_range<CListSegmented<int>>);
+    // Memory mapped array
+    static_assert(std::ranges::contiguous_range<CListHuge<int>>);
+    // Small buffer array
+    static_assert(std::ranges::contiguous_range<CListSmall<int, 8>>);
+    // Inplace array
+    static_assert(std::ranges::contiguous_range<CListInplace<int, 8>>);
+
+    /**
+     * Layout of the dynamic list: the storage handle is a pointer, a size and a capacity,
+     * plus the IListView vtable pointer. Tables of lists (CList<CList<T>>) rely on it.
+     */
+    static_assert(sizeof(Internal::CContainer<int, 0, false, Growth::CExact<>>) == 3 * sizeof(void *));
+    static_assert(sizeof(CList<int>) == 4 * sizeof(void *));
+    static_assert(sizeof(CList<int, Growth::CAmortized>) == sizeof(CList<int>));
+}
+
+namespace eho::pmr {
+    /**
+     * Lists allocating from a std::pmr::memory_resource, e.g. per request lists on a
+     * std::pmr::monotonic_buffer_resource released at once. The elements are constructed with the
+     * list's allocator, so std::pmr containers stored in the list use the same resource.
+     */
+    template<typename t_tType, Growth::GrowthPolicy t_tGrowth = Growth::CExact<>>
+    using CList = eho::CList<t_tType, t_tGrowth, std::pmr::polymorphic_allocator<t_tType>>;
+
+    template<typename t_tType, Growth::GrowthPolicy t_tGrowth = Growth::CExact<>>
+    using CListLinked = eho::CListLinked<t_tType, t_tGrowth, std::pmr::polymorphic_allocator<t_tType>>;
+
+    template<typename t_tType, size_t t_uSize, Growth::GrowthPolicy t_tGrowth = Growth::CExact<>>
+    using CListSmall = eho::CListSmall<t_tType, t_uSize, t_tGrowth, std::pmr::polymorphic_allocator<t_tType>>;
+
+    static_assert(std::ranges::contiguous_range<CList<int>>);
+    static_assert(std::ranges::bidirectional_range<CListLinked<int>>);
+}
+
+// Bit packed CList<bool>
+#include "ListBool.hpp"
+
+namespace eho {
+    static_assert(std::ranges::random_access_range<CList<bool>>);
+    static_assert(std::ranges::output_range<CList<bool>, bool>);
+    static_assert(sizeof(CList<bool>) == sizeof(CList<uint64_t>) + sizeof(size_t));
 }
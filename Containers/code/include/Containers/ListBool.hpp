@@ -0,0 +1,481 @@
+/**
+ * @file ListBool.hpp
+ * @brief Bit packed specialization of CList<bool>, included by List.hpp.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "List.hpp"
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace eho::Internal {
+    inline constexpr size_t s_uWordBits = 64;
+
+    /**
+     * Mask of the uCount low bits, uCount <= 64.
+     */
+    constexpr uint64_t LowBits(size_t uCount) {
+        return uCount >= s_uWordBits ? ~uint64_t{0} : (uint64_t{1} << uCount) - 1;
+    }
+
+    /**
+     * Proxy reference to a bit of a packed list.
+     * Assigning through it, even a const one, assigns the bit, so algorithms can write through the iterators.
+     */
+    class CBitReference {
+    public:
+        constexpr CBitReference(uint64_t *pWord, size_t uBit) : m_pWord{pWord}, m_uMask{uint64_t{1} << uBit} {}
+
+        constexpr CBitReference(const CBitReference &) = default;
+
+        constexpr operator bool() const {
+            return (*m_pWord & m_uMask) != 0;
+        }
+
+        constexpr const CBitReference &operator=(bool bValue) const {
+            *m_pWord = bValue ? *m_pWord | m_uMask : *m_pWord & ~m_uMask;
+            return *this;
+        }
+
+        constexpr const CBitReference &operator=(const CBitReference &Other) const {
+            return *this = static_cast<bool>(Other);
+        }
+
+        constexpr CBitReference &operator=(const CBitReference &Other) {
+            std::as_const(*this) = static_cast<bool>(Other);
+            return *this;
+        }
+
+        constexpr void flip() const {
+            *m_pWord ^= m_uMask;
+        }
+
+        /**
+         * Swaps the bits, not the references.
+         */
+        friend constexpr void swap(const CBitReference &Left, const CBitReference &Right) {
+            bool bLeft = Left;
+            Left = static_cast<bool>(Right);
+            Right = bLeft;
+        }
+
+    private:
+        uint64_t *m_pWord;
+        uint64_t m_uMask;
+    };
+
+    /**
+     * Random access iterator over the bits of a packed list, a word pointer and the bit index.
+     * Dereferencing it returns a CBitReference, or a bool for the const iterators.
+     * @tparam t_tWord uint64_t, const qualified for the const iterators.
+     */
+    template<typename t_tWord>
+    class CBitIterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = bool;
+        using reference = std::conditional_t<std::is_const_v<t_tWord>, bool, CBitReference>;
+
+        constexpr CBitIterator() = default;
+
+        constexpr CBitIterator(t_tWord *pWords, difference_type iIndex) : m_pWords{pWords}, m_iIndex{iIndex} {}
+
+        /**
+         * Const iterator from a mutable one.
+         */
+        template<typename t_tOther>
+        requires(!std::is_same_v<t_tOther, t_tWord> && std::is_convertible_v<t_tOther *, t_tWord *>)
+        constexpr CBitIterator(const CBitIterator<t_tOther> &Other) : m_pWords{Other.m_pWords}, m_iIndex{Other.m_iIndex} {}
+
+        constexpr reference operator*() const {
+            auto uIndex = static_cast<size_t>(m_iIndex);
+            if constexpr (std::is_const_v<t_tWord>) {
+                return (m_pWords[uIndex / s_uWordBits] >> (uIndex % s_uWordBits) & 1) != 0;
+            } else {
+                return {m_pWords + uIndex / s_uWordBits, uIndex % s_uWordBits};
+            }
+        }
+
+        constexpr reference operator[](difference_type diff) const { return *(*this + diff); }
+
+        constexpr CBitIterator &operator++() {
+            ++m_iIndex;
+            return *this;
+        }
+
+        constexpr CBitIterator operator++(int) {
+            CBitIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        constexpr CBitIterator &operator--() {
+            --m_iIndex;
+            return *this;
+        }
+
+        constexpr CBitIterator operator--(int) {
+            CBitIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        constexpr CBitIterator &operator+=(difference_type diff) {
+            m_iIndex += diff;
+            return *this;
+        }
+
+        constexpr CBitIterator &operator-=(difference_type diff) {
+            m_iIndex -= diff;
+            return *this;
+        }
+
+        constexpr CBitIterator operator+(difference_type diff) const { return {m_pWords, m_iIndex + diff}; }
+
+        constexpr CBitIterator operator-(difference_type diff) const { return {m_pWords, m_iIndex - diff}; }
+
+        friend constexpr CBitIterator operator+(difference_type diff, const CBitIterator &it) { return it + diff; }
+
+        constexpr difference_type operator-(const CBitIterator &it) const { return m_iIndex - it.m_iIndex; }
+
+        // The iterators of the same list share their words, the index is enough
+        constexpr bool operator==(const CBitIterator &it) const { return m_iIndex == it.m_iIndex; }
+
+        constexpr std::strong_ordering operator<=>(const CBitIterator &it) const { return m_iIndex <=> it.m_iIndex; }
+
+    private:
+        template<typename t_tOther>
+        friend class CBitIterator;
+
+        t_tWord *m_pWords{nullptr};
+        difference_type m_iIndex{0};
+    };
+}
+
+namespace eho {
+    /**
+     * Dynamic list of flags packed 64 per word, 8 times smaller than a byte per flag.
+     * count(), find_first(), any(), all() and the bitwise operators between lists process a word at a time.
+     * <br/><br/>
+     * Like std::vector<bool> the elements are not addressable: operator[] and the iterators return a
+     * CBitReference proxy, words() exposes the packed words and the list is not an IListView.
+     * The bits past size() in the last word are always cleared.
+     */
+    template<Growth::GrowthPolicy t_tGrowth, typename t_tAllocator>
+    class CDynamicListImplementation<bool, 0, false, t_tGrowth, t_tAllocator> {
+    protected:
+        using WordAllocator = typename std::allocator_traits<t_tAllocator>::template rebind_alloc<uint64_t>;
+        using Words = CDynamicListImplementation<uint64_t, 0, false, t_tGrowth, WordAllocator>;
+
+    public:
+        using allocator_type = t_tAllocator;
+        using Iterator = Internal::CBitIterator<uint64_t>;
+        using ConstIterator = Internal::CBitIterator<const uint64_t>;
+
+        constexpr CDynamicListImplementation() = default;
+
+        /**
+         * Empty list allocating from Allocator, e.g. a std::pmr::polymorphic_allocator of an arena.
+         */
+        explicit CDynamicListImplementation(const t_tAllocator &Allocator)
+        requires std::constructible_from<Words, const WordAllocator &>: m_lstWords{WordAllocator(Allocator)} {}
+
+        bool at(size_t uIndex) const {
+            if (uIndex >= m_uSize) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            return (*this)[uIndex];
+        }
+
+        Internal::CBitReference at(size_t uIndex) {
+            if (uIndex >= m_uSize) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            return (*this)[uIndex];
+        }
+
+        bool operator[](size_t uIndex) const {
+            return (m_lstWords.data()[uIndex / Internal::s_uWordBits] >> (uIndex % Internal::s_uWordBits) & 1) != 0;
+        }
+
+        Internal::CBitReference operator[](size_t uIndex) {
+            return {m_lstWords.data() + uIndex / Internal::s_uWordBits, uIndex % Internal::s_uWordBits};
+        }
+
+        size_t size() const {
+            return m_uSize;
+        }
+
+        size_t capacity() const {
+            return m_lstWords.capacity() * Internal::s_uWordBits;
+        }
+
+        bool empty() const {
+            return m_uSize == 0;
+        }
+
+        /**
+         * The packed flags, bit i % 64 of word i / 64 is the flag i.
+         */
+        std::span<const uint64_t> words() const {
+            return {m_lstWords.data(), m_lstWords.size()};
+        }
+
+        Iterator begin() {
+            return {m_lstWords.data(), 0};
+        }
+
+        Iterator end() {
+            return {m_lstWords.data(), static_cast<std::ptrdiff_t>(m_uSize)};
+        }
+
+        ConstIterator begin() const {
+            return {m_lstWords.data(), 0};
+        }
+
+        ConstIterator end() const {
+            return {m_lstWords.data(), static_cast<std::ptrdiff_t>(m_uSize)};
+        }
+
+        /**
+         * Will resize the container to hold uNewSize flags, rounded up to whole words.
+         * Like CList::resize() it only changes the capacity, and destroys the last flags if uNewSize < size().
+         */
+        void resize(size_t uNewSize) {
+            if (uNewSize < m_uSize) {
+                m_uSize = uNewSize;
+                m_lstWords.erase(WordCount(uNewSize), m_lstWords.size());
+                ClearTail();
+            }
+            m_lstWords.resize(WordCount(uNewSize));
+        }
+
+        void clear() {
+            m_lstWords.clear();
+            m_uSize = 0;
+        }
+
+        void insert(bool bValue) {
+            if (m_uSize % Internal::s_uWordBits == 0) {
+                m_lstWords.insert(uint64_t{0});
+            }
+            m_lstWords.data()[m_uSize / Internal::s_uWordBits] |= uint64_t{bValue} << (m_uSize % Internal::s_uWordBits);
+            ++m_uSize;
+        }
+
+        /**
+         * Inserts bValue before uIndex, the following flags are shifted a word at a time.
+         */
+        void insert(size_t uIndex, bool bValue) {
+            if (uIndex > m_uSize) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            if (m_uSize % Internal::s_uWordBits == 0) {
+                m_lstWords.insert(uint64_t{0});
+            }
+            uint64_t *pWords = m_lstWords.data();
+            size_t uWord = uIndex / Internal::s_uWordBits;
+            for (size_t i = m_lstWords.size() - 1; i > uWord; --i) {
+                pWords[i] = pWords[i] << 1 | pWords[i - 1] >> (Internal::s_uWordBits - 1);
+            }
+            size_t uBit = uIndex % Internal::s_uWordBits;
+            uint64_t uLow = Internal::LowBits(uBit);
+            pWords[uWord] = (pWords[uWord] & uLow) | (pWords[uWord] & ~uLow) << 1 | uint64_t{bValue} << uBit;
+            ++m_uSize;
+        }
+
+        /**
+         * Inserts the flags of Range at the end of the list.
+         */
+        template<std::ranges::input_range t_tRange>
+        requires std::convertible_to<std::ranges::range_reference_t<t_tRange>, bool>
+        void append_range(t_tRange &&Range) {
+            if constexpr (std::ranges::sized_range<t_tRange>) {
+                m_lstWords.resize(std::max(m_lstWords.capacity(), WordCount(m_uSize + std::ranges::size(Range))));
+            }
+            for (bool bValue: Range) {
+                insert(bValue);
+            }
+        }
+
+        std::optional<bool> pop() {
+            size_t uIndex = m_uSize == 0 ? 0 : m_uSize - 1;
+            return this->pop(uIndex);
+        }
+
+        std::optional<bool> pop(size_t uIndex) {
+            std::optional<bool> RtnVal{};
+            if (uIndex < m_uSize) {
+                RtnVal.emplace((*this)[uIndex]);
+                erase(uIndex, uIndex + 1);
+            }
+
+            return RtnVal;
+        }
+
+        /**
+         * Removes the flags in [uFirst, uLast), the tail is shifted a word at a time.
+         */
+        void erase(size_t uFirst, size_t uLast) {
+            if (uFirst > uLast || uLast > m_uSize) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            // Each chunk fills the rest of a destination word, read from at most two source words
+            uint64_t *pWords = m_lstWords.data();
+            while (uLast < m_uSize) {
+                size_t uChunk = std::min(Internal::s_uWordBits - uFirst % Internal::s_uWordBits, m_uSize - uLast);
+                uint64_t uBits = ReadBits(uLast, uChunk);
+                uint64_t uMask = Internal::LowBits(uChunk) << (uFirst % Internal::s_uWordBits);
+                uint64_t &uWord = pWords[uFirst / Internal::s_uWordBits];
+                uWord = (uWord & ~uMask) | uBits << (uFirst % Internal::s_uWordBits);
+                uFirst += uChunk;
+                uLast += uChunk;
+            }
+            m_uSize = uFirst;
+            m_lstWords.erase(WordCount(m_uSize), m_lstWords.size());
+            ClearTail();
+        }
+
+        /**
+         * Amount of set flags.
+         */
+        size_t count() const {
+            size_t uCount = 0;
+            for (uint64_t uWord: words()) {
+                uCount += static_cast<size_t>(std::popcount(uWord));
+            }
+            return uCount;
+        }
+
+        /**
+         * Index of the first flag equal to bValue, or size() if there is none.
+         */
+        size_t find_first(bool bValue = true) const {
+            // Searching false is searching true in the complemented words
+            uint64_t uFlip = bValue ? 0 : ~uint64_t{0};
+            std::span<const uint64_t> spanWords = words();
+            for (size_t i = 0; i < spanWords.size(); ++i) {
+                if (uint64_t uWord = spanWords[i] ^ uFlip; uWord != 0) {
+                    return std::min(m_uSize, i * Internal::s_uWordBits + static_cast<size_t>(std::countr_zero(uWord)));
+                }
+            }
+            return m_uSize;
+        }
+
+        /**
+         * If any flag is set.
+         */
+        bool any() const {
+            return std::ranges::any_of(words(), [](uint64_t uWord) { return uWord != 0; });
+        }
+
+        /**
+         * If every flag is set, true for an empty list.
+         */
+        bool all() const {
+            return find_first(false) == m_uSize;
+        }
+
+        bool none() const {
+            return !any();
+        }
+
+        /**
+         * Complements every flag.
+         */
+        void flip() {
+            for (uint64_t &uWord: std::span{m_lstWords.data(), m_lstWords.size()}) {
+                uWord = ~uWord;
+            }
+            ClearTail();
+        }
+
+        /**
+         * Bitwise operations with a list of the same size, throws std::invalid_argument otherwise.
+         */
+        CDynamicListImplementation &operator&=(const CDynamicListImplementation &Other) {
+            return Combine(Other, [](uint64_t uLeft, uint64_t uRight) { return uLeft & uRight; });
+        }
+
+        CDynamicListImplementation &operator|=(const CDynamicListImplementation &Other) {
+            return Combine(Other, [](uint64_t uLeft, uint64_t uRight) { return uLeft | uRight; });
+        }
+
+        CDynamicListImplementation &operator^=(const CDynamicListImplementation &Other) {
+            return Combine(Other, [](uint64_t uLeft, uint64_t uRight) { return uLeft ^ uRight; });
+        }
+
+        bool operator==(const CDynamicListImplementation &Other) const {
+            return m_uSize == Other.m_uSize && std::ranges::equal(words(), Other.words());
+        }
+
+        t_tAllocator get_allocator() const requires requires(const Words &lstWords) { lstWords.get_allocator(); } {
+            return t_tAllocator(m_lstWords.get_allocator());
+        }
+
+    protected:
+        Words m_lstWords{};
+        size_t m_uSize{0};
+
+        static constexpr size_t WordCount(size_t uBits) {
+            return (uBits + Internal::s_uWordBits - 1) / Internal::s_uWordBits;
+        }
+
+        /**
+         * uCount <= 64 flags from uIndex, in the low bits.
+         */
+        uint64_t ReadBits(size_t uIndex, size_t uCount) const {
+            const uint64_t *pWords = m_lstWords.data();
+            size_t uWord = uIndex / Internal::s_uWordBits;
+            size_t uBit = uIndex % Internal::s_uWordBits;
+            uint64_t uBits = pWords[uWord] >> uBit;
+            if (uBit + uCount > Internal::s_uWordBits) {
+                uBits |= pWords[uWord + 1] << (Internal::s_uWordBits - uBit);
+            }
+            return uBits & Internal::LowBits(uCount);
+        }
+
+        /**
+         * Clears the bits past size() in the last word.
+         */
+        void ClearTail() {
+            if (size_t uBit = m_uSize % Internal::s_uWordBits; uBit != 0) {
+                m_lstWords.data()[m_lstWords.size() - 1] &= Internal::LowBits(uBit);
+            }
+        }
+
+        template<typename t_tOperation>
+        CDynamicListImplementation &Combine(const CDynamicListImplementation &Other, t_tOperation Operation) {
+            if (m_uSize != Other.m_uSize) {
+                throw std::invalid_argument{"The lists have different sizes"};
+            }
+
+            uint64_t *pWords = m_lstWords.data();
+            const uint64_t *pOther = Other.m_lstWords.data();
+            for (size_t i = 0; i < m_lstWords.size(); ++i) {
+                pWords[i] = Operation(pWords[i], pOther[i]);
+            }
+            return *this;
+        }
+    };
+}
@@ -0,0 +1,412 @@
+/**
+ * @file ListConcurrent.hpp
+ * @brief Append-only list, any amount of threads push at the end without locking.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "List.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+namespace eho::Internal {
+    /**
+     * Log2 of the elements of the concurrent list's first segment, which holds t_uBlockSize bytes.
+     */
+    template<typename t_tType, size_t t_uBlockSize>
+    inline constexpr size_t s_uConcurrentFirstShift = static_cast<size_t>(std::countr_zero(
+            Growth::CSegmented<t_uBlockSize>::BlockCapacity(sizeof(t_tType))));
+
+    /**
+     * Random access iterator over the segments of the concurrent list.
+     * The segment 0 holds the first 2^t_uFirstShift elements and every following segment doubles the capacity,
+     * so the segment of an index is the bit width of its high bits.
+     * @tparam t_tType Element's data type, const qualified for the ConstIterator.
+     * @tparam t_uFirstShift Log2 of the elements of the first segment.
+     */
+    template<typename t_tType, size_t t_uFirstShift>
+    class CConcurrentIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<t_tType>;
+        using pointer = t_tType *;
+        using reference = t_tType &;
+        using Segment = std::atomic<value_type *>;
+
+        CConcurrentIterator() : m_pSegments{nullptr}, m_uIndex{0} {}
+
+        CConcurrentIterator(const Segment *pSegments, size_t uIndex) : m_pSegments{pSegments}, m_uIndex{uIndex} {}
+
+        /**
+         * Segment holding uIndex.
+         */
+        static size_t SegmentOf(size_t uIndex) {
+            return static_cast<size_t>(std::bit_width(uIndex >> t_uFirstShift));
+        }
+
+        /**
+         * Index of the first element of the segment uSegment.
+         */
+        static size_t SegmentBase(size_t uSegment) {
+            return uSegment == 0 ? 0 : size_t{1} << (t_uFirstShift + uSegment - 1);
+        }
+
+        /**
+         * Amount of elements of the segment uSegment.
+         */
+        static size_t SegmentSize(size_t uSegment) {
+            return uSegment == 0 ? size_t{1} << t_uFirstShift : SegmentBase(uSegment);
+        }
+
+        reference operator*() const {
+            size_t uSegment = SegmentOf(m_uIndex);
+            return m_pSegments[uSegment].load(std::memory_order_acquire)[m_uIndex - SegmentBase(uSegment)];
+        }
+
+        pointer operator->() const { return &**this; }
+
+        reference operator[](difference_type diff) const { return *(*this + diff); }
+
+        CConcurrentIterator &operator++() {
+            ++m_uIndex;
+            return *this;
+        }
+
+        CConcurrentIterator operator++(int) {
+            CConcurrentIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        CConcurrentIterator &operator--() {
+            --m_uIndex;
+            return *this;
+        }
+
+        CConcurrentIterator operator--(int) {
+            CConcurrentIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        CConcurrentIterator &operator+=(difference_type diff) {
+            m_uIndex += static_cast<size_t>(diff);
+            return *this;
+        }
+
+        CConcurrentIterator &operator-=(difference_type diff) {
+            m_uIndex -= static_cast<size_t>(diff);
+            return *this;
+        }
+
+        CConcurrentIterator operator+(difference_type diff) const {
+            return CConcurrentIterator(m_pSegments, m_uIndex + static_cast<size_t>(diff));
+        }
+
+        CConcurrentIterator operator-(difference_type diff) const {
+            return CConcurrentIterator(m_pSegments, m_uIndex - static_cast<size_t>(diff));
+        }
+
+        friend CConcurrentIterator operator+(difference_type diff, const CConcurrentIterator &it) { return it + diff; }
+
+        difference_type operator-(const CConcurrentIterator &it) const {
+            return static_cast<difference_type>(m_uIndex - it.m_uIndex);
+        }
+
+        // The iterators of the same list share the segment table, the index is enough
+        bool operator==(const CConcurrentIterator &it) const { return m_uIndex == it.m_uIndex; }
+
+        std::strong_ordering operator<=>(const CConcurrentIterator &it) const { return m_uIndex <=> it.m_uIndex; }
+
+    private:
+        const Segment *m_pSegments;
+        size_t m_uIndex;
+    };
+}
+
+namespace eho {
+    /**
+     * Append-only list shared by many threads, push_back() and emplace_back() are wait-free.
+     * <br/><br/>
+     * A push claims its index with a single fetch_add, constructs the element in place and sets the index's bit
+     * in the segment's ready mask. The segments are allocated lazily by the first thread that needs them, the
+     * losers of the race free their allocation, and are never moved: the first one holds t_uBlockSize bytes
+     * and every following one doubles the capacity, so the table has a fixed amount of entries.
+     * <br/><br/>
+     * The elements become visible once every element before them is constructed: size() and snapshot()
+     * advance the published size over the ready prefix. The list and its snapshots are read only views of
+     * the published elements and can be read while other threads push.
+     * <br/><br/>
+     * The pushes are noexcept, a constructor or an allocation that throws terminates, as the claimed index
+     * could never be published. Destroying the list must not race with the pushes.
+     * @tparam t_uBlockSize Size of the first segment in bytes.
+     * @tparam t_tAllocator Allocator of the segments, rebound to allocate the ready masks.
+     */
+    template<typename t_tType, size_t t_uBlockSize = 4096, typename t_tAllocator = std::allocator<t_tType>>
+    requires(std::has_single_bit(t_uBlockSize))
+    class CListConcurrent : public IListView<t_tType, Internal::CConcurrentIterator<
+            const t_tType, Internal::s_uConcurrentFirstShift<t_tType, t_uBlockSize>>> {
+    protected:
+        using AllocatorTraits = std::allocator_traits<t_tAllocator>;
+        using MaskAllocator = typename AllocatorTraits::template rebind_alloc<std::atomic<uint64_t>>;
+        using MaskAllocatorTraits = std::allocator_traits<MaskAllocator>;
+        static_assert(std::is_same_v<typename AllocatorTraits::value_type, t_tType>);
+
+        static constexpr size_t s_uFirstShift = Internal::s_uConcurrentFirstShift<t_tType, t_uBlockSize>;
+        static constexpr size_t s_uMaxSegments = 64 - s_uFirstShift + 1;
+
+    public:
+        using allocator_type = t_tAllocator;
+        using ConstIterator = Internal::CConcurrentIterator<const t_tType, s_uFirstShift>;
+
+        /**
+         * Frozen view of the elements published when it was taken, later pushes don't change it.
+         * It reads the list's segments, so it must not outlive the list.
+         */
+        class CSnapshot : public IListView<t_tType, ConstIterator> {
+        public:
+            CSnapshot(const typename ConstIterator::Segment *pSegments, size_t uSize) :
+                    m_pSegments{pSegments}, m_uSize{uSize} {}
+
+            const t_tType &at(size_t uIndex) const override {
+                if (uIndex >= m_uSize) {
+                    throw std::out_of_range{"Requested index is out of range"};
+                }
+
+                return (*this)[uIndex];
+            }
+
+            const t_tType &operator[](size_t uIndex) const override {
+                return begin()[static_cast<std::ptrdiff_t>(uIndex)];
+            }
+
+            size_t size() const override {
+                return m_uSize;
+            }
+
+            bool empty() const override {
+                return m_uSize == 0;
+            }
+
+            ConstIterator begin() const override {
+                return ConstIterator(m_pSegments, 0);
+            }
+
+            ConstIterator end() const override {
+                return ConstIterator(m_pSegments, m_uSize);
+            }
+
+        private:
+            const typename ConstIterator::Segment *m_pSegments;
+            size_t m_uSize;
+        };
+
+        CListConcurrent() : CListConcurrent(t_tAllocator{}) {}
+
+        explicit CListConcurrent(const t_tAllocator &Allocator) : m_Allocator{Allocator} {}
+
+        CListConcurrent(const CListConcurrent &) = delete;
+
+        CListConcurrent &operator=(const CListConcurrent &) = delete;
+
+        ~CListConcurrent() {
+            size_t uCount = m_uClaimed.load(std::memory_order_acquire);
+            MaskAllocator MaskAlloc{m_Allocator};
+            for (size_t uSegment = 0; uSegment < s_uMaxSegments; ++uSegment) {
+                size_t uBase = ConstIterator::SegmentBase(uSegment);
+                size_t uSize = ConstIterator::SegmentSize(uSegment);
+                if (t_tType *pData = m_Segments[uSegment].load(std::memory_order_relaxed)) {
+                    for (size_t i = uBase; i < std::min(uCount, uBase + uSize); ++i) {
+                        AllocatorTraits::destroy(m_Allocator, pData + (i - uBase));
+                    }
+                    AllocatorTraits::deallocate(m_Allocator, pData, uSize);
+                }
+                if (std::atomic<uint64_t> *pMask = m_Masks[uSegment].load(std::memory_order_relaxed)) {
+                    MaskAllocatorTraits::deallocate(MaskAlloc, pMask, MaskWords(uSegment));
+                }
+            }
+        }
+
+        const t_tType &at(size_t uIndex) const override {
+            if (uIndex >= size()) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            return (*this)[uIndex];
+        }
+
+        /**
+         * Unchecked, uIndex must be below a size() read by this thread.
+         */
+        const t_tType &operator[](size_t uIndex) const override {
+            return begin()[static_cast<std::ptrdiff_t>(uIndex)];
+        }
+
+        /**
+         * Amount of published elements, advanced over the elements constructed since the last call.
+         */
+        size_t size() const override {
+            return Publish();
+        }
+
+        bool empty() const override {
+            return size() == 0;
+        }
+
+        /**
+         * Amount of claimed indices, including the elements still being constructed.
+         */
+        size_t claimed() const {
+            return m_uClaimed.load(std::memory_order_relaxed);
+        }
+
+        t_tAllocator get_allocator() const {
+            return m_Allocator;
+        }
+
+        ConstIterator begin() const override {
+            return ConstIterator(m_Segments.data(), 0);
+        }
+
+        ConstIterator end() const override {
+            return ConstIterator(m_Segments.data(), size());
+        }
+
+        /**
+         * Consistent view of the elements published so far.
+         */
+        CSnapshot snapshot() const {
+            return CSnapshot(m_Segments.data(), Publish());
+        }
+
+        /**
+         * Allocates the segments holding the first uCapacity elements, so the pushes never allocate.
+         */
+        void reserve(size_t uCapacity) {
+            size_t uSegments = uCapacity == 0 ? 0 : ConstIterator::SegmentOf(uCapacity - 1) + 1;
+            for (size_t uSegment = 0; uSegment < uSegments; ++uSegment) {
+                Data(uSegment);
+                Mask(uSegment);
+            }
+        }
+
+        void push_back(const t_tType &Item) noexcept {
+            this->emplace_back(Item);
+        }
+
+        void push_back(t_tType &&Item) noexcept {
+            this->emplace_back(std::move(Item));
+        }
+
+        /**
+         * Constructs an element at the end of the list.
+         * @return The index of the new element, it is visible to the readers once size() is above it.
+         */
+        template<typename... t_tArgs>
+        requires std::constructible_from<t_tType, t_tArgs...>
+        size_t emplace_back(t_tArgs &&... Args) noexcept {
+            size_t uIndex = m_uClaimed.fetch_add(1, std::memory_order_relaxed);
+            size_t uSegment = ConstIterator::SegmentOf(uIndex);
+            size_t uOffset = uIndex - ConstIterator::SegmentBase(uSegment);
+            AllocatorTraits::construct(m_Allocator, Data(uSegment) + uOffset, std::forward<t_tArgs>(Args)...);
+            Mask(uSegment)[uOffset / 64].fetch_or(uint64_t{1} << (uOffset % 64), std::memory_order_release);
+            return uIndex;
+        }
+
+    protected:
+        alignas(Internal::s_uCacheLineSize) std::atomic<size_t> m_uClaimed{0};
+        alignas(Internal::s_uCacheLineSize) mutable std::atomic<size_t> m_uPublished{0};
+        alignas(Internal::s_uCacheLineSize) std::array<typename ConstIterator::Segment, s_uMaxSegments> m_Segments{};
+        std::array<std::atomic<std::atomic<uint64_t> *>, s_uMaxSegments> m_Masks{};
+        [[no_unique_address]] t_tAllocator m_Allocator;
+
+        static constexpr size_t MaskWords(size_t uSegment) {
+            return (ConstIterator::SegmentSize(uSegment) + 63) / 64;
+        }
+
+        /**
+         * Elements of the segment uSegment, allocated by the first caller.
+         */
+        t_tType *Data(size_t uSegment) {
+            t_tType *pData = m_Segments[uSegment].load(std::memory_order_acquire);
+            if (pData == nullptr) {
+                t_tType *pNew = AllocatorTraits::allocate(m_Allocator, ConstIterator::SegmentSize(uSegment));
+                if (m_Segments[uSegment].compare_exchange_strong(pData, pNew, std::memory_order_acq_rel)) {
+                    pData = pNew;
+                } else {
+                    AllocatorTraits::deallocate(m_Allocator, pNew, ConstIterator::SegmentSize(uSegment));
+                }
+            }
+            return pData;
+        }
+
+        /**
+         * Ready mask of the segment uSegment, allocated cleared by the first caller.
+         */
+        std::atomic<uint64_t> *Mask(size_t uSegment) {
+            std::atomic<uint64_t> *pMask = m_Masks[uSegment].load(std::memory_order_acquire);
+            if (pMask == nullptr) {
+                MaskAllocator MaskAlloc{m_Allocator};
+                std::atomic<uint64_t> *pNew = MaskAllocatorTraits::allocate(MaskAlloc, MaskWords(uSegment));
+                for (size_t i = 0; i < MaskWords(uSegment); ++i) {
+                    std::construct_at(pNew + i, 0);
+                }
+                if (m_Masks[uSegment].compare_exchange_strong(pMask, pNew, std::memory_order_acq_rel)) {
+                    pMask = pNew;
+                } else {
+                    MaskAllocatorTraits::deallocate(MaskAlloc, pNew, MaskWords(uSegment));
+                }
+            }
+            return pMask;
+        }
+
+        /**
+         * Advances the published size over the run of ready elements following it, a mask word at a time.
+         * @return The published size, never lower than the one seen by a previous call.
+         */
+        size_t Publish() const {
+            size_t uPublished = m_uPublished.load(std::memory_order_acquire);
+            size_t uEnd = uPublished;
+            while (true) {
+                size_t uSegment = ConstIterator::SegmentOf(uEnd);
+                std::atomic<uint64_t> *pMask = m_Masks[uSegment].load(std::memory_order_acquire);
+                if (pMask == nullptr) {
+                    break;
+                }
+                size_t uOffset = uEnd - ConstIterator::SegmentBase(uSegment);
+                size_t uAvailable = std::min(64 - uOffset % 64, ConstIterator::SegmentSize(uSegment) - uOffset);
+                uint64_t uBits = pMask[uOffset / 64].load(std::memory_order_acquire) >> (uOffset % 64);
+                auto uReady = std::min(static_cast<size_t>(std::countr_one(uBits)), uAvailable);
+                uEnd += uReady;
+                if (uReady < uAvailable) {
+                    break;
+                }
+            }
+            // Another reader may have published further meanwhile
+            while (uEnd > uPublished &&
+                   !m_uPublished.compare_exchange_weak(uPublished, uEnd, std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+            }
+            return std::max(uPublished, uEnd);
+        }
+    };
+
+    /**
+     * Static asserts for the concurrent list's iterators
+     */
+    static_assert(std::ranges::random_access_range<const CListConcurrent<int>>);
+    static_assert(std::ranges::random_access_range<CListConcurrent<int>::CSnapshot>);
+}
@@ -0,0 +1,461 @@
+/**
+ * @file ListCow.hpp
+ * @brief Block list whose snapshots share the blocks, a block is copied when it is written while shared.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "List.hpp"
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace eho {
+    /**
+     * List of fixed size blocks with O(1) copy-on-write snapshots.
+     * <br/><br/>
+     * The blocks and the block table are reference counted. snapshot() only increments the table's count,
+     * the list and its snapshots then share every element. The first write after a snapshot copies the table,
+     * which holds a pointer per block, and the written block; the other blocks stay shared.
+     * A block is freed with the last table referencing it.
+     * <br/><br/>
+     * Only the owning thread writes the list and takes its snapshots. The snapshots are read only views
+     * that can be copied, read and destroyed by any thread and outlive the list.
+     * @tparam t_uBlockSize Size of a block in bytes, rounded down to a power of two amount of elements.
+     * @tparam t_tAllocator Allocator of the elements, rebound to allocate the blocks and the tables.
+     */
+    template<typename t_tType, size_t t_uBlockSize = 4096, typename t_tAllocator = std::allocator<t_tType>>
+    requires(std::has_single_bit(t_uBlockSize))
+    class CListCow : public IListView<t_tType, Internal::CSegmentIterator<const t_tType, static_cast<size_t>(
+            std::countr_zero(Growth::CSegmented<t_uBlockSize>::BlockCapacity(sizeof(t_tType))))>> {
+    protected:
+        using AllocatorTraits = std::allocator_traits<t_tAllocator>;
+        static_assert(std::is_same_v<typename AllocatorTraits::value_type, t_tType>);
+
+        static constexpr size_t s_uBlock = Growth::CSegmented<t_uBlockSize>::BlockCapacity(sizeof(t_tType));
+        static constexpr size_t s_uBlockShift = static_cast<size_t>(std::countr_zero(s_uBlock));
+
+        /**
+         * Elements of a block, referenced by every table sharing it.
+         */
+        struct CBlock {
+            std::atomic<size_t> m_uRefs{1};
+            size_t m_uCount{0};
+            alignas(t_tType) std::byte m_arData[s_uBlock * sizeof(t_tType)];
+
+            t_tType *Data() {
+                return reinterpret_cast<t_tType *>(m_arData);
+            }
+        };
+
+        /**
+         * Blocks of the list, referenced by the list and its snapshots.
+         * m_lstData holds the elements of m_lstBlocks, the layout the segment iterator reads.
+         */
+        struct CTable {
+            explicit CTable(const t_tAllocator &Allocator) : m_Allocator{Allocator} {}
+
+            std::atomic<size_t> m_uRefs{1};
+            size_t m_uSize{0};
+            CList<t_tType *, Growth::CDouble> m_lstData{};
+            CList<CBlock *, Growth::CDouble> m_lstBlocks{};
+            [[no_unique_address]] t_tAllocator m_Allocator;
+        };
+
+        using BlockAllocator = typename AllocatorTraits::template rebind_alloc<CBlock>;
+        using BlockAllocatorTraits = std::allocator_traits<BlockAllocator>;
+        using TableAllocator = typename AllocatorTraits::template rebind_alloc<CTable>;
+        using TableAllocatorTraits = std::allocator_traits<TableAllocator>;
+
+    public:
+        using allocator_type = t_tAllocator;
+        using Iterator = Internal::CSegmentIterator<t_tType, s_uBlockShift>;
+        using ConstIterator = Internal::CSegmentIterator<const t_tType, s_uBlockShift>;
+
+        /**
+         * Frozen view of the list when it was taken, the list's later writes copy the blocks they change.
+         */
+        class CSnapshot : public IListView<t_tType, ConstIterator> {
+        public:
+            CSnapshot() : m_pTable{nullptr} {}
+
+            explicit CSnapshot(CTable *pTable) : m_pTable{pTable} {}
+
+            CSnapshot(const CSnapshot &Other) : m_pTable{Other.m_pTable} {
+                AcquireTable(m_pTable);
+            }
+
+            CSnapshot(CSnapshot &&Other) noexcept: m_pTable{std::exchange(Other.m_pTable, nullptr)} {}
+
+            CSnapshot &operator=(CSnapshot Other) noexcept {
+                std::swap(m_pTable, Other.m_pTable);
+                return *this;
+            }
+
+            ~CSnapshot() {
+                ReleaseTable(m_pTable);
+            }
+
+            const t_tType &at(size_t uIndex) const override {
+                if (uIndex >= size()) {
+                    throw std::out_of_range{"Requested index is out of range"};
+                }
+
+                return (*this)[uIndex];
+            }
+
+            const t_tType &operator[](size_t uIndex) const override {
+                return m_pTable->m_lstData[uIndex >> s_uBlockShift][uIndex & (s_uBlock - 1)];
+            }
+
+            size_t size() const override {
+                return m_pTable == nullptr ? 0 : m_pTable->m_uSize;
+            }
+
+            bool empty() const override {
+                return size() == 0;
+            }
+
+            ConstIterator begin() const override {
+                return ConstIterator(Blocks(m_pTable), 0);
+            }
+
+            ConstIterator end() const override {
+                return ConstIterator(Blocks(m_pTable), size());
+            }
+
+        private:
+            CTable *m_pTable;
+        };
+
+        CListCow() : CListCow(t_tAllocator{}) {}
+
+        explicit CListCow(const t_tAllocator &Allocator) : m_pTable{nullptr}, m_Allocator{Allocator} {}
+
+        CListCow(const CListCow &) = delete;
+
+        CListCow(CListCow &&Other) noexcept: m_pTable{std::exchange(Other.m_pTable, nullptr)},
+                                             m_Allocator{Other.m_Allocator} {}
+
+        CListCow &operator=(const CListCow &) = delete;
+
+        CListCow &operator=(CListCow &&Other) noexcept {
+            std::swap(m_pTable, Other.m_pTable);
+            std::swap(m_Allocator, Other.m_Allocator);
+            return *this;
+        }
+
+        ~CListCow() {
+            ReleaseTable(m_pTable);
+        }
+
+        const t_tType &at(size_t uIndex) const override {
+            if (uIndex >= size()) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            return (*this)[uIndex];
+        }
+
+        /**
+         * Copies the element's block first if a snapshot shares it.
+         */
+        t_tType &at(size_t uIndex) {
+            if (uIndex >= size()) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            return (*this)[uIndex];
+        }
+
+        const t_tType &operator[](size_t uIndex) const override {
+            return m_pTable->m_lstData[uIndex >> s_uBlockShift][uIndex & (s_uBlock - 1)];
+        }
+
+        /**
+         * Unchecked, copies the element's block first if a snapshot shares it.
+         */
+        t_tType &operator[](size_t uIndex) {
+            return DetachBlock(uIndex >> s_uBlockShift)[uIndex & (s_uBlock - 1)];
+        }
+
+        size_t size() const override {
+            return m_pTable == nullptr ? 0 : m_pTable->m_uSize;
+        }
+
+        bool empty() const override {
+            return size() == 0;
+        }
+
+        t_tAllocator get_allocator() const {
+            return m_Allocator;
+        }
+
+        ConstIterator begin() const override {
+            return ConstIterator(Blocks(m_pTable), 0);
+        }
+
+        ConstIterator end() const override {
+            return ConstIterator(Blocks(m_pTable), size());
+        }
+
+        /**
+         * Copies every block shared with a snapshot, prefer the const iterators and operator[] to write a few.
+         */
+        Iterator begin() {
+            DetachAll();
+            return Iterator(m_pTable == nullptr ? nullptr : m_pTable->m_lstData.data(), 0);
+        }
+
+        Iterator end() {
+            DetachAll();
+            return Iterator(m_pTable == nullptr ? nullptr : m_pTable->m_lstData.data(), size());
+        }
+
+        /**
+         * Shares the current elements in O(1), no element is copied.
+         */
+        CSnapshot snapshot() const {
+            AcquireTable(m_pTable);
+            return CSnapshot(m_pTable);
+        }
+
+        void insert(const t_tType &Item) {
+            this->emplace_back(Item);
+        }
+
+        void insert(t_tType &&Item) {
+            this->emplace_back(std::move(Item));
+        }
+
+        void push_back(const t_tType &Item) {
+            this->emplace_back(Item);
+        }
+
+        void push_back(t_tType &&Item) {
+            this->emplace_back(std::move(Item));
+        }
+
+        /**
+         * Constructs an element at the end of the list, copying the last block first if a snapshot shares it.
+         */
+        template<typename... t_tArgs>
+        requires std::constructible_from<t_tType, t_tArgs...>
+        t_tType &emplace_back(t_tArgs &&... Args) {
+            DetachTable();
+            size_t uOffset = m_pTable->m_uSize & (s_uBlock - 1);
+            if (uOffset == 0) {
+                AppendBlock(NewBlock());
+            }
+            CBlock *pBlock = DetachBlockPointer(m_pTable->m_lstBlocks.size() - 1);
+            try {
+                AllocatorTraits::construct(m_Allocator, pBlock->Data() + uOffset, std::forward<t_tArgs>(Args)...);
+            } catch (...) {
+                if (uOffset == 0) {
+                    PopBlock();
+                }
+                throw;
+            }
+            ++pBlock->m_uCount;
+            ++m_pTable->m_uSize;
+            return pBlock->Data()[uOffset];
+        }
+
+        /**
+         * Removes the last element.
+         * @return The removed element, or nothing if the list is empty.
+         */
+        std::optional<t_tType> pop() {
+            if (empty()) {
+                return std::nullopt;
+            }
+
+            CBlock *pBlock = DetachBlockPointer(m_pTable->m_lstBlocks.size() - 1);
+            t_tType *pItem = pBlock->Data() + pBlock->m_uCount - 1;
+            std::optional<t_tType> Item{std::move(*pItem)};
+            AllocatorTraits::destroy(m_Allocator, pItem);
+            --pBlock->m_uCount;
+            --m_pTable->m_uSize;
+            if (pBlock->m_uCount == 0) {
+                PopBlock();
+            }
+            return Item;
+        }
+
+        /**
+         * Drops the list's references, the snapshots keep their elements.
+         */
+        void clear() {
+            ReleaseTable(std::exchange(m_pTable, nullptr));
+        }
+
+    protected:
+        CTable *m_pTable;
+        [[no_unique_address]] t_tAllocator m_Allocator;
+
+        static t_tType *const *Blocks(const CTable *pTable) {
+            return pTable == nullptr ? nullptr : pTable->m_lstData.data();
+        }
+
+        static void AcquireTable(CTable *pTable) {
+            if (pTable != nullptr) {
+                pTable->m_uRefs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * Drops a reference to the table, the last one releases its blocks and frees it.
+         */
+        static void ReleaseTable(CTable *pTable) {
+            if (pTable == nullptr || pTable->m_uRefs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+
+            t_tAllocator Allocator{pTable->m_Allocator};
+            for (CBlock *pBlock: pTable->m_lstBlocks) {
+                ReleaseBlock(Allocator, pBlock);
+            }
+            TableAllocator TableAlloc{Allocator};
+            TableAllocatorTraits::destroy(TableAlloc, pTable);
+            TableAllocatorTraits::deallocate(TableAlloc, pTable, 1);
+        }
+
+        /**
+         * Drops a reference to the block, the last one destroys its elements and frees it.
+         */
+        static void ReleaseBlock(t_tAllocator &Allocator, CBlock *pBlock) {
+            if (pBlock->m_uRefs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+
+            for (size_t i = 0; i < pBlock->m_uCount; ++i) {
+                AllocatorTraits::destroy(Allocator, pBlock->Data() + i);
+            }
+            BlockAllocator BlockAlloc{Allocator};
+            BlockAllocatorTraits::destroy(BlockAlloc, pBlock);
+            BlockAllocatorTraits::deallocate(BlockAlloc, pBlock, 1);
+        }
+
+        CBlock *NewBlock() {
+            BlockAllocator BlockAlloc{m_Allocator};
+            CBlock *pBlock = BlockAllocatorTraits::allocate(BlockAlloc, 1);
+            BlockAllocatorTraits::construct(BlockAlloc, pBlock);
+            return pBlock;
+        }
+
+        void AppendBlock(CBlock *pBlock) {
+            try {
+                m_pTable->m_lstBlocks.insert(pBlock);
+                m_pTable->m_lstData.insert(pBlock->Data());
+            } catch (...) {
+                if (m_pTable->m_lstBlocks.size() > m_pTable->m_lstData.size()) {
+                    m_pTable->m_lstBlocks.pop();
+                }
+                ReleaseBlock(m_Allocator, pBlock);
+                throw;
+            }
+        }
+
+        /**
+         * Removes the last block of the unshared table.
+         */
+        void PopBlock() {
+            ReleaseBlock(m_Allocator, *m_pTable->m_lstBlocks.pop());
+            m_pTable->m_lstData.pop();
+        }
+
+        /**
+         * Gives the list its own table, copying the shared one. The copy references the same blocks.
+         */
+        void DetachTable() {
+            if (m_pTable == nullptr) {
+                TableAllocator TableAlloc{m_Allocator};
+                CTable *pTable = TableAllocatorTraits::allocate(TableAlloc, 1);
+                TableAllocatorTraits::construct(TableAlloc, pTable, m_Allocator);
+                m_pTable = pTable;
+                return;
+            }
+            if (m_pTable->m_uRefs.load(std::memory_order_acquire) == 1) {
+                return;
+            }
+
+            TableAllocator TableAlloc{m_Allocator};
+            CTable *pTable = TableAllocatorTraits::allocate(TableAlloc, 1);
+            TableAllocatorTraits::construct(TableAlloc, pTable, m_Allocator);
+            try {
+                pTable->m_lstBlocks.append_range(m_pTable->m_lstBlocks);
+                pTable->m_lstData.append_range(m_pTable->m_lstData);
+            } catch (...) {
+                TableAllocatorTraits::destroy(TableAlloc, pTable);
+                TableAllocatorTraits::deallocate(TableAlloc, pTable, 1);
+                throw;
+            }
+            for (CBlock *pBlock: pTable->m_lstBlocks) {
+                pBlock->m_uRefs.fetch_add(1, std::memory_order_relaxed);
+            }
+            pTable->m_uSize = m_pTable->m_uSize;
+            ReleaseTable(std::exchange(m_pTable, pTable));
+        }
+
+        /**
+         * Gives the list its own copy of the block uBlock if a snapshot shares it.
+         */
+        CBlock *DetachBlockPointer(size_t uBlock) {
+            DetachTable();
+            CBlock *&pBlock = m_pTable->m_lstBlocks[uBlock];
+            if (pBlock->m_uRefs.load(std::memory_order_acquire) == 1) {
+                return pBlock;
+            }
+
+            CBlock *pCopy = NewBlock();
+            if constexpr (std::is_trivially_copyable_v<t_tType>) {
+                std::memcpy(pCopy->m_arData, pBlock->m_arData, pBlock->m_uCount * sizeof(t_tType));
+                pCopy->m_uCount = pBlock->m_uCount;
+            } else {
+                try {
+                    for (; pCopy->m_uCount < pBlock->m_uCount; ++pCopy->m_uCount) {
+                        AllocatorTraits::construct(m_Allocator, pCopy->Data() + pCopy->m_uCount,
+                                                   std::as_const(pBlock->Data()[pCopy->m_uCount]));
+                    }
+                } catch (...) {
+                    ReleaseBlock(m_Allocator, pCopy);
+                    throw;
+                }
+            }
+            ReleaseBlock(m_Allocator, std::exchange(pBlock, pCopy));
+            m_pTable->m_lstData[uBlock] = pCopy->Data();
+            return pCopy;
+        }
+
+        t_tType *DetachBlock(size_t uBlock) {
+            return DetachBlockPointer(uBlock)->Data();
+        }
+
+        void DetachAll() {
+            if (m_pTable == nullptr) {
+                return;
+            }
+            for (size_t uBlock = 0; uBlock < m_pTable->m_lstBlocks.size(); ++uBlock) {
+                DetachBlockPointer(uBlock);
+            }
+        }
+    };
+
+    /**
+     * Static asserts for the copy-on-write list's iterators
+     */
+    static_assert(std::ranges::random_access_range<CListCow<int>>);
+    static_assert(std::ranges::random_access_range<const CListCow<int>>);
+    static_assert(std::ranges::random_access_range<CListCow<int>::CSnapshot>);
+}
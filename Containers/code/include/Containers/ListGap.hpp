@@ -0,0 +1,455 @@
+/**
+ * @file ListGap.hpp
+ * @brief Gap buffer list, insertions and removals next to the last edit are O(1) amortized.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "List.hpp"
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace eho::Internal {
+    /**
+     * Random access iterator over a gap buffer, the indexes past the gap's start skip the gap when dereferenced.
+     * @tparam t_tType Element's data type, const qualified for the ConstIterator.
+     */
+    template<typename t_tType>
+    class CGapIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<t_tType>;
+        using pointer = t_tType *;
+        using reference = t_tType &;
+
+        CGapIterator() : m_pData{nullptr}, m_uGapStart{0}, m_uGapSize{0}, m_uIndex{0} {}
+
+        CGapIterator(t_tType *pData, size_t uGapStart, size_t uGapSize, size_t uIndex) :
+                m_pData{pData}, m_uGapStart{uGapStart}, m_uGapSize{uGapSize}, m_uIndex{uIndex} {}
+
+        /**
+         * Const iterator from a mutable one.
+         */
+        template<typename t_tOther>
+        requires(!std::is_same_v<t_tOther, t_tType> && std::is_convertible_v<t_tOther *, t_tType *>)
+        CGapIterator(const CGapIterator<t_tOther> &Other) :
+                m_pData{Other.m_pData}, m_uGapStart{Other.m_uGapStart}, m_uGapSize{Other.m_uGapSize},
+                m_uIndex{Other.m_uIndex} {}
+
+        reference operator*() const {
+            return m_pData[m_uIndex < m_uGapStart ? m_uIndex : m_uIndex + m_uGapSize];
+        }
+
+        pointer operator->() const { return &**this; }
+
+        reference operator[](difference_type diff) const { return *(*this + diff); }
+
+        CGapIterator &operator++() {
+            ++m_uIndex;
+            return *this;
+        }
+
+        CGapIterator operator++(int) {
+            CGapIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        CGapIterator &operator--() {
+            --m_uIndex;
+            return *this;
+        }
+
+        CGapIterator operator--(int) {
+            CGapIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        CGapIterator &operator+=(difference_type diff) {
+            m_uIndex += static_cast<size_t>(diff);
+            return *this;
+        }
+
+        CGapIterator &operator-=(difference_type diff) {
+            m_uIndex -= static_cast<size_t>(diff);
+            return *this;
+        }
+
+        CGapIterator operator+(difference_type diff) const {
+            return CGapIterator(m_pData, m_uGapStart, m_uGapSize, m_uIndex + static_cast<size_t>(diff));
+        }
+
+        CGapIterator operator-(difference_type diff) const {
+            return CGapIterator(m_pData, m_uGapStart, m_uGapSize, m_uIndex - static_cast<size_t>(diff));
+        }
+
+        friend CGapIterator operator+(difference_type diff, const CGapIterator &it) { return it + diff; }
+
+        difference_type operator-(const CGapIterator &it) const {
+            return static_cast<difference_type>(m_uIndex - it.m_uIndex);
+        }
+
+        // The iterators of the same list share the buffer, the index is enough
+        bool operator==(const CGapIterator &it) const { return m_uIndex == it.m_uIndex; }
+
+        std::strong_ordering operator<=>(const CGapIterator &it) const { return m_uIndex <=> it.m_uIndex; }
+
+    private:
+        template<typename t_tOther>
+        friend class CGapIterator;
+
+        t_tType *m_pData;
+        size_t m_uGapStart;
+        size_t m_uGapSize;
+        size_t m_uIndex;
+    };
+}
+
+namespace eho {
+    /**
+     * Gap buffer list, the free capacity is a gap kept where the last edit happened.
+     * <br/><br/>
+     * Inserting or removing at index i first moves the gap to i, which moves the elements between the old and
+     * the new position, then only fills or widens the gap. Consecutive edits around a cursor are O(1) amortized
+     * while the indexed access and the iterators skip the gap. Editing far away is as costly as in CList.
+     * @tparam t_tGrowth Growth policy, geometric by default so the gap does not fill after every insertion.
+     * @tparam t_tAllocator Allocator of the buffer.
+     */
+    template<typename t_tType, Growth::GrowthPolicy t_tGrowth = Growth::CAmortized,
+            typename t_tAllocator = std::allocator<t_tType>>
+    class CListGap : public IListView<t_tType, Internal::CGapIterator<const t_tType>> {
+    protected:
+        using AllocatorTraits = std::allocator_traits<t_tAllocator>;
+        static_assert(std::is_same_v<typename AllocatorTraits::value_type, t_tType>);
+
+    public:
+        using allocator_type = t_tAllocator;
+        using Iterator = Internal::CGapIterator<t_tType>;
+        using ConstIterator = Internal::CGapIterator<const t_tType>;
+
+        CListGap() = default;
+
+        explicit CListGap(const t_tAllocator &Allocator) : m_Allocator{Allocator} {}
+
+        CListGap(CListGap &&Other) noexcept : m_Allocator{Other.m_Allocator} {
+            Steal(Other);
+        }
+
+        /**
+         * Takes Other's buffer if the allocator propagates or both allocators are equal,
+         * otherwise the elements are moved one by one into this list's buffer.
+         */
+        CListGap &operator=(CListGap &&Other) noexcept(
+                AllocatorTraits::propagate_on_container_move_assignment::value ||
+                AllocatorTraits::is_always_equal::value) {
+            if (this != &Other) {
+                clear();
+                if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+                    m_Allocator = Other.m_Allocator;
+                }
+                if (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                    m_Allocator == Other.m_Allocator) {
+                    Steal(Other);
+                } else {
+                    for (auto &Item: Other) {
+                        this->insert(std::move(Item));
+                    }
+                    Other.clear();
+                }
+            }
+            return *this;
+        }
+
+        ~CListGap() {
+            std::destroy_n(m_pData, m_uGapStart);
+            std::destroy(m_pData + GapEnd(), m_pData + m_uCapacity);
+            Deallocate();
+        }
+
+        const t_tType &at(size_t uIndex) const override {
+            return (*this)[uIndex];
+        }
+
+        t_tType &at(size_t uIndex) {
+            return (*this)[uIndex];
+        }
+
+        /**
+         * Checked like the other lists, throws std::out_of_range.
+         */
+        const t_tType &operator[](size_t uIndex) const override {
+            CheckIndex(uIndex, size());
+            return m_pData[Slot(uIndex)];
+        }
+
+        t_tType &operator[](size_t uIndex) {
+            CheckIndex(uIndex, size());
+            return m_pData[Slot(uIndex)];
+        }
+
+        size_t size() const override {
+            return m_uCapacity - m_uGapSize;
+        }
+
+        bool empty() const override {
+            return size() == 0;
+        }
+
+        size_t capacity() const {
+            return m_uCapacity;
+        }
+
+        /**
+         * @return The index the gap is at, the position of the last edit.
+         */
+        size_t gap() const {
+            return m_uGapStart;
+        }
+
+        t_tAllocator get_allocator() const {
+            return m_Allocator;
+        }
+
+        /**
+         * Sets the capacity to exactly uNewSize, the last elements past uNewSize are destroyed.
+         */
+        void resize(size_t uNewSize) {
+            if (uNewSize < size()) {
+                erase(uNewSize, size());
+            }
+            Reallocate(uNewSize, m_uGapStart);
+        }
+
+        void clear() {
+            resize(0);
+        }
+
+        void insert(const t_tType &Item) {
+            this->emplace(size(), Item);
+        }
+
+        void insert(t_tType &&Item) {
+            this->emplace(size(), std::move(Item));
+        }
+
+        void insert(size_t uIndex, const t_tType &Item) {
+            this->emplace(uIndex, Item);
+        }
+
+        void insert(size_t uIndex, t_tType &&Item) {
+            this->emplace(uIndex, std::move(Item));
+        }
+
+        /**
+         * Constructs an element before uIndex in the gap, moving the gap there first.
+         * @return The new element.
+         */
+        template<typename... t_tArgs>
+        requires std::constructible_from<t_tType, t_tArgs...>
+        t_tType &emplace(size_t uIndex, t_tArgs &&... Args) {
+            CheckIndex(uIndex, size() + 1);
+            if (uIndex != m_uGapStart || m_uGapSize == 0) {
+                // Moving the gap moves the elements the arguments may reference
+                t_tType Item(std::forward<t_tArgs>(Args)...);
+                Reserve(uIndex, 1);
+                return Fill(std::move(Item));
+            }
+            return Fill(std::forward<t_tArgs>(Args)...);
+        }
+
+        /**
+         * Inserts the elements of [First, Last) before uIndex, the gap is moved and widened at most once.
+         */
+        template<std::forward_iterator t_tIterator, std::sentinel_for<t_tIterator> t_tSentinel>
+        requires std::constructible_from<t_tType, std::iter_reference_t<t_tIterator>>
+        void insert(size_t uIndex, t_tIterator First, t_tSentinel Last) {
+            CheckIndex(uIndex, size() + 1);
+            Reserve(uIndex, static_cast<size_t>(std::ranges::distance(First, Last)));
+            for (; First != Last; ++First) {
+                Fill(*First);
+            }
+        }
+
+        std::optional<t_tType> pop() {
+            return this->pop(size() == 0 ? 0 : size() - 1);
+        }
+
+        /**
+         * Removes the element uIndex, the gap is moved to uIndex and absorbs its slot.
+         */
+        std::optional<t_tType> pop(size_t uIndex) {
+            std::optional<t_tType> RtnVal{};
+            if (uIndex < size()) {
+                MoveGap(uIndex);
+                RtnVal.emplace(std::move(m_pData[GapEnd()]));
+                AllocatorTraits::destroy(m_Allocator, m_pData + GapEnd());
+                m_uGapSize += 1;
+                Shrink();
+            }
+
+            return RtnVal;
+        }
+
+        /**
+         * Removes the elements in [uFirst, uLast), the gap is moved to uFirst and absorbs them.
+         */
+        void erase(size_t uFirst, size_t uLast) {
+            if (uFirst > uLast || uLast > size()) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            MoveGap(uFirst);
+            std::destroy(m_pData + GapEnd(), m_pData + GapEnd() + (uLast - uFirst));
+            m_uGapSize += uLast - uFirst;
+            Shrink();
+        }
+
+        Iterator begin() {
+            return Iterator(m_pData, m_uGapStart, m_uGapSize, 0);
+        }
+
+        Iterator end() {
+            return Iterator(m_pData, m_uGapStart, m_uGapSize, size());
+        }
+
+        ConstIterator begin() const override {
+            return ConstIterator(m_pData, m_uGapStart, m_uGapSize, 0);
+        }
+
+        ConstIterator end() const override {
+            return ConstIterator(m_pData, m_uGapStart, m_uGapSize, size());
+        }
+
+    protected:
+        t_tType *m_pData = nullptr;
+        size_t m_uCapacity = 0;
+        size_t m_uGapStart = 0;
+        size_t m_uGapSize = 0;
+        [[no_unique_address]] t_tAllocator m_Allocator;
+
+        inline size_t GapEnd() const {
+            return m_uGapStart + m_uGapSize;
+        }
+
+        inline size_t Slot(size_t uIndex) const {
+            return uIndex < m_uGapStart ? uIndex : uIndex + m_uGapSize;
+        }
+
+        static inline void CheckIndex(size_t uIndex, size_t uSize) {
+            if (uIndex >= uSize) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+        }
+
+        /**
+         * Constructs an element at the start of the gap.
+         */
+        template<typename... t_tArgs>
+        t_tType &Fill(t_tArgs &&... Args) {
+            t_tType *pSlot = m_pData + m_uGapStart;
+            AllocatorTraits::construct(m_Allocator, pSlot, std::forward<t_tArgs>(Args)...);
+            m_uGapStart += 1;
+            m_uGapSize -= 1;
+            return *pSlot;
+        }
+
+        /**
+         * Moves the gap before the element uIndex, only the elements between both positions are moved.
+         */
+        void MoveGap(size_t uIndex) {
+            if (uIndex < m_uGapStart) {
+                Internal::ShiftRight(m_pData + uIndex, m_uGapStart - uIndex, m_uGapSize);
+            } else if (uIndex > m_uGapStart) {
+                Internal::ShiftLeft(m_pData + m_uGapStart, uIndex - m_uGapStart, m_uGapSize);
+            }
+            m_uGapStart = uIndex;
+        }
+
+        /**
+         * Moves the gap to uIndex and makes it at least uCount slots wide.
+         */
+        void Reserve(size_t uIndex, size_t uCount) {
+            if (m_uGapSize < uCount) {
+                // The elements are moved once, the gap lands at uIndex in the new buffer
+                Reallocate(t_tGrowth::Grow(m_uCapacity, size() + uCount, sizeof(t_tType)), uIndex);
+            } else {
+                MoveGap(uIndex);
+            }
+        }
+
+        void Shrink() {
+            size_t uCapacity = t_tGrowth::Shrink(m_uCapacity, size(), sizeof(t_tType));
+            if (uCapacity < m_uCapacity) {
+                Reallocate(std::max(uCapacity, size()), m_uGapStart);
+            }
+        }
+
+        /**
+         * Moves the elements to a new buffer of uCapacity elements with the gap at uGapStart.
+         * @param uCapacity Must be at least the amount of elements.
+         */
+        void Reallocate(size_t uCapacity, size_t uGapStart = 0) {
+            if (uCapacity == m_uCapacity) {
+                MoveGap(uGapStart);
+                return;
+            }
+
+            size_t uSize = size();
+            t_tType *pNew = uCapacity == 0 ? nullptr : AllocatorTraits::allocate(m_Allocator, uCapacity);
+            size_t uNewGapSize = uCapacity - uSize;
+            // Both sides of the old gap, each split around the new gap's position
+            auto RelocateRange = [&](size_t uFirst, size_t uLast) {
+                for (size_t uIndex = uFirst; uIndex < uLast;) {
+                    size_t uEnd = uIndex < uGapStart ? std::min(uLast, uGapStart) : uLast;
+                    size_t uDest = uIndex < uGapStart ? uIndex : uIndex + uNewGapSize;
+                    Internal::Relocate(m_pData + Slot(uIndex), uEnd - uIndex, pNew + uDest);
+                    uIndex = uEnd;
+                }
+            };
+            RelocateRange(0, m_uGapStart);
+            RelocateRange(m_uGapStart, uSize);
+
+            Deallocate();
+            m_pData = pNew;
+            m_uCapacity = uCapacity;
+            m_uGapStart = uGapStart;
+            m_uGapSize = uNewGapSize;
+        }
+
+        void Deallocate() {
+            if (m_pData != nullptr) {
+                AllocatorTraits::deallocate(m_Allocator, m_pData, m_uCapacity);
+            }
+        }
+
+        /**
+         * Takes the buffer of Other, which is left empty. The list must be empty.
+         */
+        void Steal(CListGap &Other) {
+            Deallocate();
+            m_pData = std::exchange(Other.m_pData, nullptr);
+            m_uCapacity = std::exchange(Other.m_uCapacity, 0);
+            m_uGapStart = std::exchange(Other.m_uGapStart, 0);
+            m_uGapSize = std::exchange(Other.m_uGapSize, 0);
+        }
+    };
+
+    /**
+     * Static asserts for the gap buffer's iterators
+     */
+    static_assert(std::ranges::random_access_range<CListGap<int>>);
+    static_assert(std::ranges::random_access_range<const CListGap<int>>);
+}
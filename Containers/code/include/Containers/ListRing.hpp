@@ -0,0 +1,490 @@
+/**
+ * @file ListRing.hpp
+ * @brief Circular list, pushing and popping at both ends never shifts the elements.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "List.hpp"
+#include <array>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace eho::Internal {
+    /**
+     * Random access iterator over a circular buffer, the index is relative to the first element
+     * and wraps around the end of the buffer when dereferenced.
+     * @tparam t_tType Element's data type, const qualified for the ConstIterator.
+     */
+    template<typename t_tType>
+    class CRingIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<t_tType>;
+        using pointer = t_tType *;
+        using reference = t_tType &;
+
+        CRingIterator() : m_pData{nullptr}, m_uCapacity{0}, m_uHead{0}, m_uIndex{0} {}
+
+        CRingIterator(t_tType *pData, size_t uCapacity, size_t uHead, size_t uIndex) :
+                m_pData{pData}, m_uCapacity{uCapacity}, m_uHead{uHead}, m_uIndex{uIndex} {}
+
+        /**
+         * Const iterator from a mutable one.
+         */
+        template<typename t_tOther>
+        requires(!std::is_same_v<t_tOther, t_tType> && std::is_convertible_v<t_tOther *, t_tType *>)
+        CRingIterator(const CRingIterator<t_tOther> &Other) :
+                m_pData{Other.m_pData}, m_uCapacity{Other.m_uCapacity}, m_uHead{Other.m_uHead},
+                m_uIndex{Other.m_uIndex} {}
+
+        reference operator*() const {
+            size_t uSlot = m_uHead + m_uIndex;
+            return m_pData[uSlot >= m_uCapacity ? uSlot - m_uCapacity : uSlot];
+        }
+
+        pointer operator->() const { return &**this; }
+
+        reference operator[](difference_type diff) const { return *(*this + diff); }
+
+        CRingIterator &operator++() {
+            ++m_uIndex;
+            return *this;
+        }
+
+        CRingIterator operator++(int) {
+            CRingIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        CRingIterator &operator--() {
+            --m_uIndex;
+            return *this;
+        }
+
+        CRingIterator operator--(int) {
+            CRingIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        CRingIterator &operator+=(difference_type diff) {
+            m_uIndex += static_cast<size_t>(diff);
+            return *this;
+        }
+
+        CRingIterator &operator-=(difference_type diff) {
+            m_uIndex -= static_cast<size_t>(diff);
+            return *this;
+        }
+
+        CRingIterator operator+(difference_type diff) const {
+            return CRingIterator(m_pData, m_uCapacity, m_uHead, m_uIndex + static_cast<size_t>(diff));
+        }
+
+        CRingIterator operator-(difference_type diff) const {
+            return CRingIterator(m_pData, m_uCapacity, m_uHead, m_uIndex - static_cast<size_t>(diff));
+        }
+
+        friend CRingIterator operator+(difference_type diff, const CRingIterator &it) { return it + diff; }
+
+        difference_type operator-(const CRingIterator &it) const {
+            return static_cast<difference_type>(m_uIndex - it.m_uIndex);
+        }
+
+        // The iterators of the same list share the buffer, the index is enough
+        bool operator==(const CRingIterator &it) const { return m_uIndex == it.m_uIndex; }
+
+        std::strong_ordering operator<=>(const CRingIterator &it) const { return m_uIndex <=> it.m_uIndex; }
+
+    private:
+        template<typename t_tOther>
+        friend class CRingIterator;
+
+        t_tType *m_pData;
+        size_t m_uCapacity;
+        size_t m_uHead;
+        size_t m_uIndex;
+    };
+}
+
+namespace eho {
+    /**
+     * Circular list, the elements occupy the slots [head, head + size()) of the buffer modulo its capacity.
+     * push_front(), push_back(), pop_front() and pop_back() never shift the elements.
+     * <br/><br/>
+     * With t_uSize > 0 the t_uSize slots are stored inside the object and the list never allocates,
+     * pushing into a full list throws std::length_error. Otherwise the buffer is allocated and grows
+     * following t_tGrowth, the elements are then unwrapped at the start of the new buffer.
+     * @tparam t_uSize Inline capacity, 0 for the growable list.
+     * @tparam t_tGrowth Growth policy, Growth::CFixed for the inline capacity.
+     * @tparam t_tAllocator Allocator of the growable buffer.
+     */
+    template<typename t_tType, size_t t_uSize, Growth::GrowthPolicy t_tGrowth,
+            typename t_tAllocator = std::allocator<t_tType>>
+    requires(t_uSize == 0 || std::is_same_v<t_tGrowth, Growth::CFixed>)
+    class CRingListImplementation : public IListView<t_tType, Internal::CRingIterator<const t_tType>> {
+    protected:
+        using AllocatorTraits = std::allocator_traits<t_tAllocator>;
+        static_assert(std::is_same_v<typename AllocatorTraits::value_type, t_tType>);
+
+    public:
+        using allocator_type = t_tAllocator;
+        using Iterator = Internal::CRingIterator<t_tType>;
+        using ConstIterator = Internal::CRingIterator<const t_tType>;
+
+        CRingListImplementation() : CRingListImplementation(t_tAllocator{}) {}
+
+        explicit CRingListImplementation(const t_tAllocator &Allocator) :
+                m_pData{nullptr}, m_uCapacity{t_uSize}, m_Allocator{Allocator} {
+            m_pData = m_Inline.Data();
+        }
+
+        CRingListImplementation(CRingListImplementation &&Other) noexcept(
+                std::is_nothrow_move_constructible_v<t_tType>) : CRingListImplementation(Other.m_Allocator) {
+            Steal(Other);
+        }
+
+        /**
+         * Takes Other's buffer if the allocator propagates or both allocators are equal,
+         * otherwise the elements are moved one by one into this list's buffer.
+         */
+        CRingListImplementation &operator=(CRingListImplementation &&Other) noexcept(
+                std::is_nothrow_move_constructible_v<t_tType> &&
+                (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                 AllocatorTraits::is_always_equal::value)) {
+            if (this != &Other) {
+                clear();
+                if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+                    m_Allocator = Other.m_Allocator;
+                }
+                if (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                    m_Allocator == Other.m_Allocator) {
+                    Steal(Other);
+                } else {
+                    for (auto &Item: Other) {
+                        this->emplace_back(std::move(Item));
+                    }
+                    Other.clear();
+                }
+            }
+            return *this;
+        }
+
+        ~CRingListImplementation() {
+            Destroy(m_uCount);
+            Deallocate(m_pData, m_uCapacity);
+        }
+
+        const t_tType &at(size_t uIndex) const override {
+            return (*this)[uIndex];
+        }
+
+        t_tType &at(size_t uIndex) {
+            return (*this)[uIndex];
+        }
+
+        /**
+         * Checked like the other lists, throws std::out_of_range.
+         */
+        const t_tType &operator[](size_t uIndex) const override {
+            CheckIndex(uIndex);
+            return m_pData[Slot(uIndex)];
+        }
+
+        t_tType &operator[](size_t uIndex) {
+            CheckIndex(uIndex);
+            return m_pData[Slot(uIndex)];
+        }
+
+        t_tType &front() { return at(0); }
+
+        const t_tType &front() const { return at(0); }
+
+        t_tType &back() { return at(m_uCount - 1); }
+
+        const t_tType &back() const { return at(m_uCount - 1); }
+
+        size_t size() const override {
+            return m_uCount;
+        }
+
+        bool empty() const override {
+            return m_uCount == 0;
+        }
+
+        size_t capacity() const {
+            return m_uCapacity;
+        }
+
+        t_tAllocator get_allocator() const {
+            return m_Allocator;
+        }
+
+        /**
+         * Sets the capacity to exactly uNewSize, the last elements past uNewSize are destroyed.
+         * The list with an inline capacity only destroys the elements.
+         */
+        void resize(size_t uNewSize) {
+            if (uNewSize < m_uCount) {
+                DestroyBack(m_uCount - uNewSize);
+            }
+            if constexpr (t_uSize == 0) {
+                Reallocate(uNewSize);
+            }
+        }
+
+        void clear() {
+            resize(0);
+        }
+
+        void push_back(const t_tType &Item) {
+            this->emplace_back(Item);
+        }
+
+        void push_back(t_tType &&Item) {
+            this->emplace_back(std::move(Item));
+        }
+
+        void push_front(const t_tType &Item) {
+            this->emplace_front(Item);
+        }
+
+        void push_front(t_tType &&Item) {
+            this->emplace_front(std::move(Item));
+        }
+
+        /**
+         * Constructs an element after the last one.
+         * @return The new element.
+         */
+        template<typename... t_tArgs>
+        requires std::constructible_from<t_tType, t_tArgs...>
+        t_tType &emplace_back(t_tArgs &&... Args) {
+            if (m_uCount == m_uCapacity) {
+                // Growing moves the elements the arguments may reference
+                t_tType Item(std::forward<t_tArgs>(Args)...);
+                Grow();
+                return EmplaceAt(Slot(m_uCount), std::move(Item));
+            }
+            return EmplaceAt(Slot(m_uCount), std::forward<t_tArgs>(Args)...);
+        }
+
+        /**
+         * Constructs an element before the first one.
+         * @return The new element.
+         */
+        template<typename... t_tArgs>
+        requires std::constructible_from<t_tType, t_tArgs...>
+        t_tType &emplace_front(t_tArgs &&... Args) {
+            if (m_uCount == m_uCapacity) {
+                t_tType Item(std::forward<t_tArgs>(Args)...);
+                Grow();
+                return EmplaceFront(std::move(Item));
+            }
+            return EmplaceFront(std::forward<t_tArgs>(Args)...);
+        }
+
+        std::optional<t_tType> pop_back() {
+            std::optional<t_tType> RtnVal{};
+            if (m_uCount > 0) {
+                RtnVal.emplace(std::move((*this)[m_uCount - 1]));
+                DestroyBack(1);
+                Shrink();
+            }
+            return RtnVal;
+        }
+
+        std::optional<t_tType> pop_front() {
+            std::optional<t_tType> RtnVal{};
+            if (m_uCount > 0) {
+                RtnVal.emplace(std::move(m_pData[m_uHead]));
+                AllocatorTraits::destroy(m_Allocator, m_pData + m_uHead);
+                m_uHead = Slot(1);
+                m_uCount -= 1;
+                Shrink();
+            }
+            return RtnVal;
+        }
+
+        /**
+         * The elements as two contiguous halves, the second one is empty unless the elements wrap around
+         * the end of the buffer. Vector kernels can process each half as a plain array.
+         */
+        std::array<std::span<t_tType>, 2> as_spans() {
+            size_t uFirst = std::min(m_uCount, m_uCapacity - m_uHead);
+            return {std::span<t_tType>{m_pData + m_uHead, uFirst}, std::span<t_tType>{m_pData, m_uCount - uFirst}};
+        }
+
+        std::array<std::span<const t_tType>, 2> as_spans() const {
+            size_t uFirst = std::min(m_uCount, m_uCapacity - m_uHead);
+            return {std::span<const t_tType>{m_pData + m_uHead, uFirst},
+                    std::span<const t_tType>{m_pData, m_uCount - uFirst}};
+        }
+
+        Iterator begin() {
+            return Iterator(m_pData, m_uCapacity, m_uHead, 0);
+        }
+
+        Iterator end() {
+            return Iterator(m_pData, m_uCapacity, m_uHead, m_uCount);
+        }
+
+        ConstIterator begin() const override {
+            return ConstIterator(m_pData, m_uCapacity, m_uHead, 0);
+        }
+
+        ConstIterator end() const override {
+            return ConstIterator(m_pData, m_uCapacity, m_uHead, m_uCount);
+        }
+
+    protected:
+        t_tType *m_pData;
+        size_t m_uHead = 0;
+        size_t m_uCount = 0;
+        size_t m_uCapacity;
+        [[no_unique_address]] t_tAllocator m_Allocator;
+        [[no_unique_address]] Internal::CInlineBuffer<t_tType, t_uSize> m_Inline;
+
+        /**
+         * Slot of the buffer holding the element uIndex, uIndex must be at most the capacity.
+         */
+        inline size_t Slot(size_t uIndex) const {
+            size_t uSlot = m_uHead + uIndex;
+            return uSlot >= m_uCapacity ? uSlot - m_uCapacity : uSlot;
+        }
+
+        inline void CheckIndex(size_t uIndex) const {
+            if (uIndex >= m_uCount) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+        }
+
+        template<typename... t_tArgs>
+        t_tType &EmplaceAt(size_t uSlot, t_tArgs &&... Args) {
+            AllocatorTraits::construct(m_Allocator, m_pData + uSlot, std::forward<t_tArgs>(Args)...);
+            m_uCount += 1;
+            return m_pData[uSlot];
+        }
+
+        template<typename... t_tArgs>
+        t_tType &EmplaceFront(t_tArgs &&... Args) {
+            size_t uSlot = m_uHead == 0 ? m_uCapacity - 1 : m_uHead - 1;
+            EmplaceAt(uSlot, std::forward<t_tArgs>(Args)...);
+            m_uHead = uSlot;
+            return m_pData[uSlot];
+        }
+
+        void Destroy(size_t uCount) {
+            for (size_t i = 0; i < uCount; ++i) {
+                AllocatorTraits::destroy(m_Allocator, m_pData + Slot(i));
+            }
+        }
+
+        void DestroyBack(size_t uCount) {
+            for (; uCount > 0; --uCount) {
+                m_uCount -= 1;
+                AllocatorTraits::destroy(m_Allocator, m_pData + Slot(m_uCount));
+            }
+        }
+
+        /**
+         * Takes the elements of Other, which is left empty. The list must be empty.
+         */
+        void Steal(CRingListImplementation &Other) {
+            if constexpr (t_uSize > 0) {
+                // clear() keeps the head, the elements are stored from the start of the buffer
+                m_uHead = 0;
+                for (auto Span: Other.as_spans()) {
+                    Internal::Relocate(Span.data(), Span.size(), m_pData + m_uCount);
+                    m_uCount += Span.size();
+                }
+                Other.m_uCount = 0;
+                Other.m_uHead = 0;
+            } else {
+                Deallocate(m_pData, m_uCapacity);
+                m_pData = std::exchange(Other.m_pData, nullptr);
+                m_uCapacity = std::exchange(Other.m_uCapacity, 0);
+                m_uHead = std::exchange(Other.m_uHead, 0);
+                m_uCount = std::exchange(Other.m_uCount, 0);
+            }
+        }
+
+        void Grow() {
+            // The list with an inline capacity throws std::length_error
+            Reallocate(t_tGrowth::Grow(m_uCapacity, m_uCount + 1, sizeof(t_tType)));
+        }
+
+        void Shrink() {
+            if constexpr (t_uSize == 0) {
+                size_t uCapacity = t_tGrowth::Shrink(m_uCapacity, m_uCount, sizeof(t_tType));
+                if (uCapacity < m_uCapacity) {
+                    Reallocate(std::max(uCapacity, m_uCount));
+                }
+            }
+        }
+
+        /**
+         * Moves the elements to the start of a new buffer of uCapacity elements.
+         * @param uCapacity Must be at least the amount of elements.
+         */
+        void Reallocate(size_t uCapacity) {
+            if (uCapacity == m_uCapacity) {
+                return;
+            }
+
+            t_tType *pNew = uCapacity == 0 ? nullptr : AllocatorTraits::allocate(m_Allocator, uCapacity);
+            size_t uMoved = 0;
+            for (auto Span: as_spans()) {
+                Internal::Relocate(Span.data(), Span.size(), pNew + uMoved);
+                uMoved += Span.size();
+            }
+            Deallocate(m_pData, m_uCapacity);
+            m_pData = pNew;
+            m_uCapacity = uCapacity;
+            m_uHead = 0;
+        }
+
+        void Deallocate(t_tType *pData, size_t uCapacity) {
+            if (t_uSize == 0 && pData != nullptr) {
+                AllocatorTraits::deallocate(m_Allocator, pData, uCapacity);
+            }
+        }
+    };
+
+    /**
+     * Growable circular list.
+     * @tparam t_tGrowth Growth policy, geometric by default so pushing is amortized O(1).
+     */
+    template<typename t_tType, Growth::GrowthPolicy t_tGrowth = Growth::CAmortized,
+            typename t_tAllocator = std::allocator<t_tType>>
+    using CListRing = CRingListImplementation<t_tType, 0, t_tGrowth, t_tAllocator>;
+
+    /**
+     * Fixed capacity circular list, the t_uSize slots are stored inside the object and never allocated.
+     * Pushing into a full list throws std::length_error.
+     */
+    template<typename t_tType, size_t t_uSize>
+    requires(t_uSize > 0)
+    using CListRingStatic = CRingListImplementation<t_tType, t_uSize, Growth::CFixed>;
+
+    /**
+     * Static asserts for the circular lists' iterators
+     */
+    static_assert(std::ranges::random_access_range<CListRing<int>>);
+    static_assert(std::ranges::random_access_range<const CListRing<int>>);
+    static_assert(std::ranges::random_access_range<CListRingStatic<int, 8>>);
+}
@@ -0,0 +1,434 @@
+/**
+ * @file ListSoA.hpp
+ * @brief Struct of arrays list, each field of the records is stored in its own contiguous column.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "Storage.hpp"
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace eho::Internal {
+    /**
+     * Proxy reference to a record of a struct of arrays, a tuple of references to its fields.
+     * Assigning through it, even a const one, assigns the fields, so algorithms can write through the iterators.
+     * @tparam t_tFields Fields of the record, const for the const iterators.
+     */
+    template<typename... t_tFields>
+    class CSoAReference : public std::tuple<t_tFields &...> {
+        using Base = std::tuple<t_tFields &...>;
+
+    public:
+        using value_type = std::tuple<std::remove_const_t<t_tFields>...>;
+
+        constexpr CSoAReference(t_tFields &... Fields) : Base(Fields...) {}
+
+        constexpr CSoAReference(const CSoAReference &) = default;
+
+        /**
+         * Reference to the fields of Value, used as the common reference of the iterators.
+         */
+        constexpr CSoAReference(value_type &Value) :
+                Base(std::apply([](auto &... Fields) { return Base(Fields...); }, Value)) {}
+
+        constexpr CSoAReference(const value_type &Value) requires(std::is_const_v<t_tFields> && ...) :
+                Base(std::apply([](auto &... Fields) { return Base(Fields...); }, Value)) {}
+
+        /**
+         * Reference to const fields from a reference to mutable ones.
+         */
+        template<typename... t_tOthers>
+        requires(sizeof...(t_tOthers) == sizeof...(t_tFields) && !std::is_same_v<CSoAReference<t_tOthers...>, CSoAReference>
+                 && (std::is_convertible_v<t_tOthers &, t_tFields &> && ...))
+        constexpr CSoAReference(const CSoAReference<t_tOthers...> &Other) :
+                Base(static_cast<const std::tuple<t_tOthers &...> &>(Other)) {}
+
+        constexpr const CSoAReference &operator=(const CSoAReference &Other) const {
+            Assign(Other, std::index_sequence_for<t_tFields...>{});
+            return *this;
+        }
+
+        constexpr const CSoAReference &operator=(const value_type &Value) const {
+            Assign(Value, std::index_sequence_for<t_tFields...>{});
+            return *this;
+        }
+
+        constexpr const CSoAReference &operator=(value_type &&Value) const {
+            Assign(std::move(Value), std::index_sequence_for<t_tFields...>{});
+            return *this;
+        }
+
+        /**
+         * Field t_uIndex, for the structured bindings.
+         */
+        template<size_t t_uIndex>
+        constexpr auto &get() const {
+            return std::get<t_uIndex>(static_cast<const Base &>(*this));
+        }
+
+        /**
+         * Swaps the fields of both records, not the references.
+         */
+        friend constexpr void swap(const CSoAReference &Left, const CSoAReference &Right)
+        requires(!std::is_const_v<t_tFields> && ...) {
+            [&]<size_t... t_uIndexes>(std::index_sequence<t_uIndexes...>) {
+                (std::ranges::swap(Left.template get<t_uIndexes>(), Right.template get<t_uIndexes>()), ...);
+            }(std::index_sequence_for<t_tFields...>{});
+        }
+
+    private:
+        template<typename t_tRecord, size_t... t_uIndexes>
+        constexpr void Assign(t_tRecord &&Record, std::index_sequence<t_uIndexes...>) const {
+            ((get<t_uIndexes>() = std::get<t_uIndexes>(std::forward<t_tRecord>(Record))), ...);
+        }
+    };
+
+    /**
+     * Random access iterator over the records of a struct of arrays.
+     * It holds one pointer per column and the record index, dereferencing it returns a CSoAReference.
+     */
+    template<typename... t_tFields>
+    class CSoAIterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::tuple<std::remove_const_t<t_tFields>...>;
+        using reference = CSoAReference<t_tFields...>;
+
+        constexpr CSoAIterator() = default;
+
+        constexpr CSoAIterator(std::tuple<t_tFields *...> Columns, difference_type iIndex) :
+                m_Columns{Columns}, m_iIndex{iIndex} {}
+
+        /**
+         * Const iterator from a mutable one.
+         */
+        template<typename... t_tOthers>
+        requires(sizeof...(t_tOthers) == sizeof...(t_tFields) && !std::is_same_v<CSoAIterator<t_tOthers...>, CSoAIterator>
+                 && (std::is_convertible_v<t_tOthers *, t_tFields *> && ...))
+        constexpr CSoAIterator(const CSoAIterator<t_tOthers...> &Other) :
+                m_Columns{Other.m_Columns}, m_iIndex{Other.m_iIndex} {}
+
+        constexpr reference operator*() const {
+            return std::apply([this](auto *... pColumns) { return reference(pColumns[m_iIndex]...); }, m_Columns);
+        }
+
+        constexpr reference operator[](difference_type diff) const { return *(*this + diff); }
+
+        constexpr CSoAIterator &operator++() {
+            ++m_iIndex;
+            return *this;
+        }
+
+        constexpr CSoAIterator operator++(int) {
+            CSoAIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        constexpr CSoAIterator &operator--() {
+            --m_iIndex;
+            return *this;
+        }
+
+        constexpr CSoAIterator operator--(int) {
+            CSoAIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        constexpr CSoAIterator &operator+=(difference_type diff) {
+            m_iIndex += diff;
+            return *this;
+        }
+
+        constexpr CSoAIterator &operator-=(difference_type diff) {
+            m_iIndex -= diff;
+            return *this;
+        }
+
+        constexpr CSoAIterator operator+(difference_type diff) const { return {m_Columns, m_iIndex + diff}; }
+
+        constexpr CSoAIterator operator-(difference_type diff) const { return {m_Columns, m_iIndex - diff}; }
+
+        friend constexpr CSoAIterator operator+(difference_type diff, const CSoAIterator &it) { return it + diff; }
+
+        constexpr difference_type operator-(const CSoAIterator &it) const { return m_iIndex - it.m_iIndex; }
+
+        // The iterators of the same list share their columns, the index is enough
+        constexpr bool operator==(const CSoAIterator &it) const { return m_iIndex == it.m_iIndex; }
+
+        constexpr std::strong_ordering operator<=>(const CSoAIterator &it) const { return m_iIndex <=> it.m_iIndex; }
+
+    private:
+        template<typename... t_tOthers>
+        friend class CSoAIterator;
+
+        std::tuple<t_tFields *...> m_Columns{};
+        difference_type m_iIndex{0};
+    };
+
+    /**
+     * Qualified field t_tField of a reference qualified like t_tQualified.
+     */
+    template<typename t_tField, template<typename> typename t_tQualifier, typename t_tValue>
+    using SoACommonField = std::remove_reference_t<std::common_reference_t<t_tField &, t_tQualifier<t_tValue>>>;
+}
+
+/**
+ * The records and their proxy references share a common reference, required by std::indirectly_readable.
+ */
+template<typename... t_tFields, typename... t_tValues,
+        template<typename> typename t_tQualifier, template<typename> typename t_uQualifier>
+requires(sizeof...(t_tFields) == sizeof...(t_tValues) &&
+         (std::is_same_v<std::remove_const_t<t_tFields>, t_tValues> && ...))
+struct std::basic_common_reference<eho::Internal::CSoAReference<t_tFields...>, std::tuple<t_tValues...>,
+        t_tQualifier, t_uQualifier> {
+    using type = eho::Internal::CSoAReference<eho::Internal::SoACommonField<t_tFields, t_uQualifier, t_tValues>...>;
+};
+
+template<typename... t_tFields, typename... t_tValues,
+        template<typename> typename t_tQualifier, template<typename> typename t_uQualifier>
+requires(sizeof...(t_tFields) == sizeof...(t_tValues) &&
+         (std::is_same_v<std::remove_const_t<t_tFields>, t_tValues> && ...))
+struct std::basic_common_reference<std::tuple<t_tValues...>, eho::Internal::CSoAReference<t_tFields...>,
+        t_tQualifier, t_uQualifier> {
+    using type = eho::Internal::CSoAReference<eho::Internal::SoACommonField<t_tFields, t_tQualifier, t_tValues>...>;
+};
+
+template<typename... t_tFields>
+struct std::tuple_size<eho::Internal::CSoAReference<t_tFields...>> :
+        std::integral_constant<size_t, sizeof...(t_tFields)> {
+};
+
+template<size_t t_uIndex, typename... t_tFields>
+struct std::tuple_element<t_uIndex, eho::Internal::CSoAReference<t_tFields...>> {
+    using type = std::tuple_element_t<t_uIndex, std::tuple<t_tFields &...>>;
+};
+
+namespace eho {
+    /**
+     * Struct of arrays list, the records are tuples of fields and each field is stored in its own
+     * contiguous column. Loops reading one or two fields only bring those columns through the cache.
+     * <br/><br/>
+     * The columns are dynamic containers growing together with t_tGrowth. The iterators are random access,
+     * they return a proxy reference (a tuple of references to the fields), and column<I>() is a std::span
+     * over a single field.
+     * @tparam t_tGrowth Growth policy of every column.
+     * @tparam t_tFields Types of the fields.
+     */
+    template<Growth::GrowthPolicy t_tGrowth, typename... t_tFields>
+    requires(sizeof...(t_tFields) > 0)
+    class CSoAListImplementation {
+    protected:
+        template<typename t_tField>
+        using Column = Internal::CContainer<t_tField, 0, false, t_tGrowth>;
+
+        template<size_t t_uIndex>
+        using Field = std::tuple_element_t<t_uIndex, std::tuple<t_tFields...>>;
+
+        using Indexes = std::index_sequence_for<t_tFields...>;
+
+    public:
+        using value_type = std::tuple<t_tFields...>;
+        using reference = Internal::CSoAReference<t_tFields...>;
+        using const_reference = Internal::CSoAReference<const t_tFields...>;
+        using Iterator = Internal::CSoAIterator<t_tFields...>;
+        using ConstIterator = Internal::CSoAIterator<const t_tFields...>;
+
+        CSoAListImplementation() = default;
+
+        size_t size() const {
+            return std::get<0>(m_Columns).count();
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        size_t capacity() const {
+            return std::get<0>(m_Columns).size();
+        }
+
+        /**
+         * Sets the capacity of every column to exactly uNewSize, see CDynamicListImplementation::resize().
+         */
+        void resize(size_t uNewSize) {
+            std::apply([uNewSize](auto &... Columns) { (Columns.resize(uNewSize), ...); }, m_Columns);
+        }
+
+        void clear() {
+            resize(0);
+        }
+
+        reference operator[](size_t uIndex) {
+            return *(begin() + static_cast<std::ptrdiff_t>(uIndex));
+        }
+
+        const_reference operator[](size_t uIndex) const {
+            return *(begin() + static_cast<std::ptrdiff_t>(uIndex));
+        }
+
+        reference at(size_t uIndex) {
+            CheckIndex(uIndex, size());
+            return (*this)[uIndex];
+        }
+
+        const_reference at(size_t uIndex) const {
+            CheckIndex(uIndex, size());
+            return (*this)[uIndex];
+        }
+
+        /**
+         * Contiguous view of the field t_uIndex of every record.
+         */
+        template<size_t t_uIndex>
+        std::span<Field<t_uIndex>> column() {
+            return {std::get<t_uIndex>(m_Columns).data(), size()};
+        }
+
+        template<size_t t_uIndex>
+        std::span<const Field<t_uIndex>> column() const {
+            return {std::get<t_uIndex>(m_Columns).data(), size()};
+        }
+
+        void insert(const value_type &Record) {
+            this->insert(size(), Record);
+        }
+
+        void insert(value_type &&Record) {
+            this->insert(size(), std::move(Record));
+        }
+
+        void insert(size_t uIndex, const value_type &Record) {
+            std::apply([this, uIndex](const auto &... Fields) { this->emplace(uIndex, Fields...); }, Record);
+        }
+
+        void insert(size_t uIndex, value_type &&Record) {
+            std::apply([this, uIndex](auto &... Fields) { this->emplace(uIndex, std::move(Fields)...); }, Record);
+        }
+
+        /**
+         * Inserts the record made of Fields before uIndex, one argument per field.
+         * If a field throws, the fields already inserted in the other columns are removed.
+         * @return The new record.
+         */
+        template<typename... t_tArgs>
+        requires(sizeof...(t_tArgs) == sizeof...(t_tFields) && (std::constructible_from<t_tFields, t_tArgs> && ...))
+        reference emplace(size_t uIndex, t_tArgs &&... Fields) {
+            size_t uSize = size();
+            CheckIndex(uIndex, uSize + 1);
+            [&]<size_t... t_uIndexes>(std::index_sequence<t_uIndexes...>) {
+                size_t uInserted = 0;
+                try {
+                    ((std::get<t_uIndexes>(m_Columns).emplace(uIndex, uSize, std::forward<t_tArgs>(Fields)),
+                            ++uInserted), ...);
+                } catch (...) {
+                    ((t_uIndexes < uInserted ? (void) std::get<t_uIndexes>(m_Columns).pop(uIndex, uSize + 1) : void()),
+                            ...);
+                    throw;
+                }
+            }(Indexes{});
+            return (*this)[uIndex];
+        }
+
+        template<typename... t_tArgs>
+        requires(sizeof...(t_tArgs) == sizeof...(t_tFields) && (std::constructible_from<t_tFields, t_tArgs> && ...))
+        reference emplace_back(t_tArgs &&... Fields) {
+            return this->emplace(size(), std::forward<t_tArgs>(Fields)...);
+        }
+
+        std::optional<value_type> pop() {
+            return this->pop(size() == 0 ? 0 : size() - 1);
+        }
+
+        std::optional<value_type> pop(size_t uIndex) {
+            std::optional<value_type> RtnVal{};
+            size_t uSize = size();
+            if (uIndex < uSize) {
+                std::apply([&](auto &... Columns) { RtnVal.emplace(Columns.pop(uIndex, uSize)...); }, m_Columns);
+            }
+
+            return RtnVal;
+        }
+
+        /**
+         * Removes the records in [uFirst, uLast), the tail of every column is shifted once.
+         */
+        void erase(size_t uFirst, size_t uLast) {
+            size_t uSize = size();
+            if (uFirst > uLast || uLast > uSize) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+
+            std::apply([&](auto &... Columns) { (Columns.erase(uFirst, uLast, uSize), ...); }, m_Columns);
+        }
+
+        /**
+         * Removes the record uIndex without shifting the tails, the last record is moved into its place.
+         */
+        std::optional<value_type> swap_remove(size_t uIndex) {
+            std::optional<value_type> RtnVal{};
+            size_t uSize = size();
+            if (uIndex < uSize) {
+                std::apply([&](auto &... Columns) { RtnVal.emplace(Columns.swap_remove(uIndex, uSize)...); },
+                           m_Columns);
+            }
+
+            return RtnVal;
+        }
+
+        Iterator begin() {
+            return {std::apply([](auto &... Columns) { return std::tuple{Columns.data()...}; }, m_Columns), 0};
+        }
+
+        Iterator end() {
+            return begin() + static_cast<std::ptrdiff_t>(size());
+        }
+
+        ConstIterator begin() const {
+            return {std::apply([](const auto &... Columns) { return std::tuple{Columns.data()...}; }, m_Columns), 0};
+        }
+
+        ConstIterator end() const {
+            return begin() + static_cast<std::ptrdiff_t>(size());
+        }
+
+    protected:
+        std::tuple<Column<t_tFields>...> m_Columns;
+
+        static void CheckIndex(size_t uIndex, size_t uSize) {
+            if (uIndex >= uSize) {
+                throw std::out_of_range{"Requested index is out of range"};
+            }
+        }
+    };
+
+    /**
+     * Struct of arrays list of records made of t_tFields, see CSoAListImplementation.
+     */
+    template<typename... t_tFields>
+    using CListSoA = CSoAListImplementation<Growth::CExact<>, t_tFields...>;
+
+    /**
+     * Static asserts for the struct of arrays iterators
+     */
+    static_assert(std::random_access_iterator<CListSoA<int, float>::Iterator>);
+    static_assert(std::random_access_iterator<CListSoA<int, float>::ConstIterator>);
+    static_assert(std::ranges::random_access_range<CListSoA<int, float>>);
+    static_assert(std::sortable<CListSoA<int, float>::Iterator>);
+}
@@ -0,0 +1,130 @@
+/**
+ * @file MappedAllocator.hpp
+ * @brief Allocator backed by anonymous memory mappings, for very large containers.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "Storage.hpp"
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#if defined(__linux__)
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#endif
+
+namespace eho {
+#if defined(__linux__)
+
+    /**
+     * Allocates every buffer as its own anonymous mapping.
+     * <br/><br/>
+     * Growing remaps the pages with mremap, the kernel moves the page table entries instead of copying the data,
+     * and the mappings of at least t_uHugePageSize bytes are advised to use transparent huge pages.
+     * Meant for lists of hundreds of millions of elements, every allocation takes at least one page.
+     * @tparam t_tType
+     * @tparam t_uHugePageSize Size of a transparent huge page.
+     */
+    template<typename t_tType, size_t t_uHugePageSize = size_t{2} << 20>
+    class CMappedAllocator {
+    public:
+        using value_type = t_tType;
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        template<typename t_tOther>
+        struct rebind {
+            using other = CMappedAllocator<t_tOther, t_uHugePageSize>;
+        };
+
+        static_assert(alignof(t_tType) <= 4096, "Mappings are only page aligned");
+
+        CMappedAllocator() = default;
+
+        template<typename t_tOther>
+        CMappedAllocator(const CMappedAllocator<t_tOther, t_uHugePageSize> &) noexcept {}
+
+        t_tType *allocate(size_t uCount) {
+            size_t uBytes = Bytes(uCount);
+            void *ptr = mmap(nullptr, uBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr == MAP_FAILED) {
+                throw std::bad_alloc{};
+            }
+            AdviseHugePages(ptr, uBytes);
+            return static_cast<t_tType *>(ptr);
+        }
+
+        void deallocate(t_tType *ptr, size_t uCount) noexcept {
+            munmap(static_cast<void *>(ptr), Bytes(uCount));
+        }
+
+        /**
+         * Resizes the mapping of uCount elements at ptr to uNewCount elements, the mapping may move.
+         * The bytes are kept, so only trivially relocatable elements can live in it.
+         */
+        t_tType *reallocate(t_tType *ptr, size_t uCount, size_t uNewCount) {
+            size_t uBytes = Bytes(uCount);
+            size_t uNewBytes = Bytes(uNewCount);
+            if (uBytes == uNewBytes) {
+                return ptr;
+            }
+
+            void *pNew = mremap(static_cast<void *>(ptr), uBytes, uNewBytes, MREMAP_MAYMOVE);
+            if (pNew == MAP_FAILED) {
+                throw std::bad_alloc{};
+            }
+            if (uNewBytes > uBytes) {
+                AdviseHugePages(pNew, uNewBytes);
+            }
+            return static_cast<t_tType *>(pNew);
+        }
+
+        template<typename t_tOther>
+        bool operator==(const CMappedAllocator<t_tOther, t_uHugePageSize> &) const noexcept {
+            return true;
+        }
+
+    private:
+        static size_t Bytes(size_t uCount) {
+            static const auto s_uPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            return (uCount * sizeof(t_tType) + s_uPageSize - 1) & ~(s_uPageSize - 1);
+        }
+
+        static void AdviseHugePages([[maybe_unused]] void *ptr, [[maybe_unused]] size_t uBytes) {
+#if defined(MADV_HUGEPAGE)
+            if (uBytes >= t_uHugePageSize) {
+                // Only a hint, the mapping works without huge pages
+                madvise(ptr, uBytes, MADV_HUGEPAGE);
+            }
+#endif
+        }
+    };
+
+    template<typename t_tType, size_t t_uHugePageSize>
+    struct is_trivially_relocatable<CMappedAllocator<t_tType, t_uHugePageSize>> : std::true_type {
+    };
+
+    static_assert(ReallocatableAllocator<CMappedAllocator<int>>);
+
+#else
+
+    /**
+     * Memory mappings are only implemented for Linux, the other platforms use the default allocator.
+     */
+    template<typename t_tType, size_t t_uHugePageSize = size_t{2} << 20>
+    using CMappedAllocator = std::allocator<t_tType>;
+
+#endif
+}
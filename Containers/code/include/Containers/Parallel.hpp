@@ -0,0 +1,339 @@
+/**
+ * @file Parallel.hpp
+ * @brief Thread pool and parallel algorithms over the random access lists.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace eho {
+    /**
+     * Fixed set of worker threads running the tasks of one job at a time.
+     * <br/><br/>
+     * Run() hands the indices [0, uTasks) out through an atomic counter, the calling thread works on them too,
+     * and returns once every task is done. Jobs submitted from several threads are serialized. A task must not
+     * call Run() on its own pool, the nested job would wait for the one running it.
+     */
+    class CThreadPool {
+    public:
+        /**
+         * @param uWorkers Amount of worker threads, the caller of Run() is one more.
+         */
+        explicit CThreadPool(size_t uWorkers = std::max(1u, std::thread::hardware_concurrency()) - 1) {
+            for (size_t i = 0; i < uWorkers; ++i) {
+                m_vecWorkers.emplace_back([this]() { WorkerLoop(); });
+            }
+        }
+
+        CThreadPool(const CThreadPool &) = delete;
+
+        CThreadPool &operator=(const CThreadPool &) = delete;
+
+        ~CThreadPool() {
+            {
+                std::scoped_lock Lock{m_Mutex};
+                m_bStop = true;
+            }
+            m_cvWork.notify_all();
+            for (auto &Worker: m_vecWorkers) {
+                Worker.join();
+            }
+        }
+
+        /**
+         * Pool shared by the parallel algorithms, one worker less than the hardware threads.
+         */
+        static CThreadPool &Default() {
+            static CThreadPool Pool{};
+            return Pool;
+        }
+
+        /**
+         * Amount of threads running a job, the workers plus the caller.
+         */
+        size_t concurrency() const {
+            return m_vecWorkers.size() + 1;
+        }
+
+        /**
+         * Calls Task(i) for every i in [0, uTasks) across the workers and the calling thread.
+         * The first exception thrown by a task is rethrown once the others are done.
+         */
+        template<std::invocable<size_t> t_tTask>
+        void Run(size_t uTasks, t_tTask &&Task) {
+            if (uTasks == 0) {
+                return;
+            }
+
+            std::scoped_lock RunLock{m_RunMutex};
+            auto Invoke = [](void *pTask, size_t uIndex) {
+                (*static_cast<std::remove_reference_t<t_tTask> *>(pTask))(uIndex);
+            };
+            CJob Job{Invoke, static_cast<void *>(std::addressof(Task)), uTasks};
+            {
+                std::scoped_lock Lock{m_Mutex};
+                m_pJob = &Job;
+                ++m_uGeneration;
+            }
+            m_cvWork.notify_all();
+            Work(Job);
+
+            // Late workers must not join, the ones still running a task hold the job
+            std::unique_lock Lock{m_Mutex};
+            m_pJob = nullptr;
+            m_cvDone.wait(Lock, [&]() { return m_uActive == 0; });
+            if (Job.m_Error) {
+                std::rethrow_exception(Job.m_Error);
+            }
+        }
+
+    protected:
+        struct CJob {
+            void (*m_pfnInvoke)(void *, size_t);
+            void *m_pTask;
+            size_t m_uTasks;
+            std::atomic<size_t> m_uNext{0};
+            std::exception_ptr m_Error{};
+        };
+
+        std::vector<std::thread> m_vecWorkers{};
+        std::mutex m_RunMutex{};
+        std::mutex m_Mutex{};
+        std::condition_variable m_cvWork{};
+        std::condition_variable m_cvDone{};
+        CJob *m_pJob = nullptr;
+        size_t m_uGeneration = 0;
+        size_t m_uActive = 0;
+        bool m_bStop = false;
+
+        void WorkerLoop() {
+            size_t uSeen = 0;
+            std::unique_lock Lock{m_Mutex};
+            while (true) {
+                m_cvWork.wait(Lock, [&]() { return m_bStop || (m_pJob != nullptr && m_uGeneration != uSeen); });
+                if (m_bStop) {
+                    return;
+                }
+                uSeen = m_uGeneration;
+                CJob *pJob = m_pJob;
+                ++m_uActive;
+                Lock.unlock();
+                Work(*pJob);
+                Lock.lock();
+                if (--m_uActive == 0) {
+                    m_cvDone.notify_all();
+                }
+            }
+        }
+
+        void Work(CJob &Job) {
+            for (size_t i; (i = Job.m_uNext.fetch_add(1, std::memory_order_relaxed)) < Job.m_uTasks;) {
+                try {
+                    Job.m_pfnInvoke(Job.m_pTask, i);
+                } catch (...) {
+                    std::scoped_lock Lock{m_Mutex};
+                    if (!Job.m_Error) {
+                        Job.m_Error = std::current_exception();
+                    }
+                }
+            }
+        }
+    };
+}
+
+namespace eho::Internal {
+    /**
+     * Ranges shorter than this run on the calling thread, waking the workers costs more than the work.
+     */
+    inline constexpr size_t s_uMinParallelSize = 1 << 14;
+
+    /**
+     * Amount of chunks of uSize elements for Pool, uPerThread chunks per thread to balance uneven tasks,
+     * none smaller than s_uMinParallelSize / 4.
+     */
+    inline size_t ChunkCount(const CThreadPool &Pool, size_t uSize, size_t uPerThread) {
+        if (uSize < s_uMinParallelSize) {
+            return 1;
+        }
+        return std::max<size_t>(1, std::min(Pool.concurrency() * uPerThread, uSize / (s_uMinParallelSize / 4)));
+    }
+
+    /**
+     * First element of the chunk uChunk when uSize elements are split in uChunks even chunks.
+     */
+    inline constexpr std::ptrdiff_t ChunkBegin(size_t uSize, size_t uChunks, size_t uChunk) {
+        return static_cast<std::ptrdiff_t>(uSize * uChunk / uChunks);
+    }
+
+    /**
+     * Sorts each of the concurrency() chunks with Sort, then merges neighbour runs in place, doubling
+     * their width every round. std::inplace_merge is stable, so a stable Sort gives a stable result.
+     */
+    template<std::random_access_iterator t_tIterator, typename t_tCompare, typename t_tSort>
+    void MergeSort(t_tIterator First, t_tIterator Last, t_tCompare &Compare, CThreadPool &Pool, t_tSort Sort) {
+        auto uSize = static_cast<size_t>(Last - First);
+        size_t uChunks = ChunkCount(Pool, uSize, 1);
+        Pool.Run(uChunks, [&](size_t uChunk) {
+            Sort(First + ChunkBegin(uSize, uChunks, uChunk), First + ChunkBegin(uSize, uChunks, uChunk + 1), Compare);
+        });
+        for (size_t uWidth = 1; uWidth < uChunks; uWidth *= 2) {
+            Pool.Run((uChunks + 2 * uWidth - 1) / (2 * uWidth), [&](size_t uPair) {
+                size_t uLeft = uPair * 2 * uWidth;
+                size_t uMiddle = std::min(uLeft + uWidth, uChunks);
+                size_t uRight = std::min(uLeft + 2 * uWidth, uChunks);
+                std::inplace_merge(First + ChunkBegin(uSize, uChunks, uLeft),
+                                   First + ChunkBegin(uSize, uChunks, uMiddle),
+                                   First + ChunkBegin(uSize, uChunks, uRight), Compare);
+            });
+        }
+    }
+}
+
+/**
+ * Parallel versions of the standard algorithms over random access ranges, e.g. CList, CListStatic or
+ * CListAligned. The range is split in chunks run by a CThreadPool, the default pool unless one is given.
+ * Ranges below Internal::s_uMinParallelSize elements run on the calling thread.
+ */
+namespace eho::Parallel {
+    template<std::ranges::random_access_range t_tRange, typename t_tCompare = std::ranges::less>
+    requires std::sortable<std::ranges::iterator_t<t_tRange>, t_tCompare>
+    void sort(t_tRange &&Range, t_tCompare Compare = {}, CThreadPool &Pool = CThreadPool::Default()) {
+        Internal::MergeSort(std::ranges::begin(Range), std::ranges::end(Range), Compare, Pool,
+                            [](auto First, auto Last, t_tCompare &Comp) { std::sort(First, Last, Comp); });
+    }
+
+    /**
+     * Equivalent elements keep their order.
+     */
+    template<std::ranges::random_access_range t_tRange, typename t_tCompare = std::ranges::less>
+    requires std::sortable<std::ranges::iterator_t<t_tRange>, t_tCompare>
+    void stable_sort(t_tRange &&Range, t_tCompare Compare = {}, CThreadPool &Pool = CThreadPool::Default()) {
+        Internal::MergeSort(std::ranges::begin(Range), std::ranges::end(Range), Compare, Pool,
+                            [](auto First, auto Last, t_tCompare &Comp) { std::stable_sort(First, Last, Comp); });
+    }
+
+    /**
+     * Writes Operation(x) for every element x of Range to the elements starting at Out, Out may be Range's begin.
+     * @return The end of the written elements.
+     */
+    template<std::ranges::random_access_range t_tRange, std::random_access_iterator t_tOutput, typename t_tOperation>
+    requires std::indirectly_writable<t_tOutput,
+            std::indirect_result_t<t_tOperation &, std::ranges::iterator_t<t_tRange>>>
+    t_tOutput transform(t_tRange &&Range, t_tOutput Out, t_tOperation Operation,
+                        CThreadPool &Pool = CThreadPool::Default()) {
+        auto First = std::ranges::begin(Range);
+        auto uSize = static_cast<size_t>(std::ranges::distance(Range));
+        size_t uChunks = Internal::ChunkCount(Pool, uSize, 4);
+        Pool.Run(uChunks, [&](size_t uChunk) {
+            std::ptrdiff_t iBegin = Internal::ChunkBegin(uSize, uChunks, uChunk);
+            std::transform(First + iBegin, First + Internal::ChunkBegin(uSize, uChunks, uChunk + 1), Out + iBegin,
+                           std::ref(Operation));
+        });
+        return Out + static_cast<std::ptrdiff_t>(uSize);
+    }
+
+    /**
+     * Folds Init and the elements of Range with Operation. The chunks are folded in order,
+     * so Operation must be associative but does not need to be commutative.
+     * Each chunk starts from its first element converted to t_tValue, like std::reduce.
+     */
+    template<std::ranges::random_access_range t_tRange, typename t_tValue, typename t_tOperation = std::plus<>>
+    requires std::constructible_from<t_tValue, std::ranges::range_reference_t<t_tRange>> &&
+             std::regular_invocable<t_tOperation &, t_tValue, std::ranges::range_reference_t<t_tRange>>
+    t_tValue reduce(t_tRange &&Range, t_tValue Init, t_tOperation Operation = {},
+                    CThreadPool &Pool = CThreadPool::Default()) {
+        auto First = std::ranges::begin(Range);
+        auto uSize = static_cast<size_t>(std::ranges::distance(Range));
+        size_t uChunks = Internal::ChunkCount(Pool, uSize, 4);
+        std::vector<std::optional<t_tValue>> vecPartials(uChunks);
+        Pool.Run(uChunks, [&](size_t uChunk) {
+            auto Begin = First + Internal::ChunkBegin(uSize, uChunks, uChunk);
+            auto End = First + Internal::ChunkBegin(uSize, uChunks, uChunk + 1);
+            if (Begin != End) {
+                vecPartials[uChunk].emplace(std::accumulate(Begin + 1, End, t_tValue(*Begin), std::ref(Operation)));
+            }
+        });
+        for (auto &Partial: vecPartials) {
+            if (Partial) {
+                Init = Operation(std::move(Init), std::move(*Partial));
+            }
+        }
+        return Init;
+    }
+
+    /**
+     * Calls Function on every element of Range, in no particular order.
+     */
+    template<std::ranges::random_access_range t_tRange, std::indirectly_unary_invocable<
+            std::ranges::iterator_t<t_tRange>> t_tFunction>
+    void for_each(t_tRange &&Range, t_tFunction Function, CThreadPool &Pool = CThreadPool::Default()) {
+        auto First = std::ranges::begin(Range);
+        auto uSize = static_cast<size_t>(std::ranges::distance(Range));
+        size_t uChunks = Internal::ChunkCount(Pool, uSize, 4);
+        Pool.Run(uChunks, [&](size_t uChunk) {
+            std::for_each(First + Internal::ChunkBegin(uSize, uChunks, uChunk),
+                          First + Internal::ChunkBegin(uSize, uChunks, uChunk + 1), std::ref(Function));
+        });
+    }
+
+    /**
+     * First element of Range matching Predicate, or its end.
+     * The chunks are scanned in blocks and stop once a match is found before them.
+     */
+    template<std::ranges::random_access_range t_tRange, std::indirect_unary_predicate<
+            std::ranges::iterator_t<t_tRange>> t_tPredicate>
+    std::ranges::iterator_t<t_tRange> find_if(t_tRange &&Range, t_tPredicate Predicate,
+                                              CThreadPool &Pool = CThreadPool::Default()) {
+        constexpr size_t uBlock = 4096;
+        auto First = std::ranges::begin(Range);
+        auto uSize = static_cast<size_t>(std::ranges::distance(Range));
+        size_t uChunks = Internal::ChunkCount(Pool, uSize, 4);
+        std::atomic<size_t> uFound{uSize};
+        Pool.Run(uChunks, [&](size_t uChunk) {
+            auto uEnd = static_cast<size_t>(Internal::ChunkBegin(uSize, uChunks, uChunk + 1));
+            for (auto i = static_cast<size_t>(Internal::ChunkBegin(uSize, uChunks, uChunk));
+                 i < uEnd && i < uFound.load(std::memory_order_relaxed); i += uBlock) {
+                auto Begin = First + static_cast<std::ptrdiff_t>(i);
+                auto End = First + static_cast<std::ptrdiff_t>(std::min(i + uBlock, uEnd));
+                auto Match = std::find_if(Begin, End, std::ref(Predicate));
+                if (Match != End) {
+                    auto uIndex = static_cast<size_t>(Match - First);
+                    size_t uCurrent = uFound.load(std::memory_order_relaxed);
+                    while (uIndex < uCurrent && !uFound.compare_exchange_weak(uCurrent, uIndex)) {
+                    }
+                    break;
+                }
+            }
+        });
+        return First + static_cast<std::ptrdiff_t>(uFound.load());
+    }
+
+    /**
+     * First element of Range equal to Value, or its end.
+     */
+    template<std::ranges::random_access_range t_tRange, typename t_tValue>
+    requires std::equality_comparable_with<std::ranges::range_reference_t<t_tRange>, const t_tValue &>
+    std::ranges::iterator_t<t_tRange> find(t_tRange &&Range, const t_tValue &Value,
+                                           CThreadPool &Pool = CThreadPool::Default()) {
+        return find_if(Range, [&](const auto &Item) { return Item == Value; }, Pool);
+    }
+}
@@ -0,0 +1,386 @@
+/**
+ * @file Queue.hpp
+ * @brief Bounded lock-free queues passing items between threads, stored in the static containers.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include "Storage.hpp"
+#include <atomic>
+#include <optional>
+#include <span>
+#include <utility>
+
+namespace eho {
+    /**
+     * Wait-free single producer, single consumer queue of t_uSize slots.
+     * <br/><br/>
+     * The slots are a static container, the items are assigned into them and moved out, so nothing is allocated
+     * after construction. The producer owns the tail index and the consumer the head index, each on its own
+     * cache line with a cached copy of the other side's index, which is only reloaded when the queue looks
+     * full or empty. Exactly one thread may push and one thread may pop at a time.
+     * @tparam t_tType Item type, default constructible and move assignable.
+     * @tparam t_uSize Amount of slots, a power of two keeps the slot computation a mask.
+     */
+    template<typename t_tType, size_t t_uSize>
+    requires(t_uSize > 0 && std::is_default_constructible_v<t_tType> && std::is_move_assignable_v<t_tType>)
+    class CQueueSPSC {
+    public:
+        CQueueSPSC() = default;
+
+        CQueueSPSC(const CQueueSPSC &) = delete;
+
+        CQueueSPSC &operator=(const CQueueSPSC &) = delete;
+
+        /**
+         * Producer side, fails if the queue is full.
+         */
+        bool try_push(const t_tType &Item) {
+            return TryPush([&Item](t_tType &Slot) { Slot = Item; });
+        }
+
+        bool try_push(t_tType &&Item) {
+            return TryPush([&Item](t_tType &Slot) { Slot = std::move(Item); });
+        }
+
+        /**
+         * Producer side, copies the longest prefix of spanItems that fits.
+         * The items are copied in at most two contiguous chunks and published at once.
+         * @return The amount of pushed items.
+         */
+        size_t try_push_n(std::span<const t_tType> spanItems) {
+            size_t uTail = m_Producer.m_uIndex.load(std::memory_order_relaxed);
+            size_t uCount = std::min(spanItems.size(), Free(uTail, spanItems.size()));
+            if (uCount == 0) {
+                return 0;
+            }
+
+            size_t uSlot = uTail % t_uSize;
+            size_t uFirst = std::min(uCount, t_uSize - uSlot);
+            std::copy_n(spanItems.begin(), uFirst, m_Storage.data() + uSlot);
+            std::copy_n(spanItems.begin() + uFirst, uCount - uFirst, m_Storage.data());
+            m_Producer.m_uIndex.store(uTail + uCount, std::memory_order_release);
+            return uCount;
+        }
+
+        /**
+         * Consumer side, empty if the queue is empty.
+         */
+        std::optional<t_tType> try_pop() {
+            std::optional<t_tType> RtnVal{};
+            size_t uHead = m_Consumer.m_uIndex.load(std::memory_order_relaxed);
+            if (Available(uHead, 1) != 0) {
+                RtnVal.emplace(std::move(m_Storage[uHead % t_uSize]));
+                m_Consumer.m_uIndex.store(uHead + 1, std::memory_order_release);
+            }
+            return RtnVal;
+        }
+
+        /**
+         * Consumer side, moves up to spanItems.size() items in at most two contiguous chunks.
+         * @return The amount of popped items.
+         */
+        size_t try_pop_n(std::span<t_tType> spanItems) {
+            size_t uHead = m_Consumer.m_uIndex.load(std::memory_order_relaxed);
+            size_t uCount = std::min(spanItems.size(), Available(uHead, spanItems.size()));
+            if (uCount == 0) {
+                return 0;
+            }
+
+            size_t uSlot = uHead % t_uSize;
+            size_t uFirst = std::min(uCount, t_uSize - uSlot);
+            std::move(m_Storage.data() + uSlot, m_Storage.data() + uSlot + uFirst, spanItems.begin());
+            std::move(m_Storage.data(), m_Storage.data() + (uCount - uFirst), spanItems.begin() + uFirst);
+            m_Consumer.m_uIndex.store(uHead + uCount, std::memory_order_release);
+            return uCount;
+        }
+
+        /**
+         * Amount of queued items, exact only if called by the producer or the consumer while the other is idle.
+         */
+        size_t size() const {
+            size_t uHead = m_Consumer.m_uIndex.load(std::memory_order_acquire);
+            return m_Producer.m_uIndex.load(std::memory_order_acquire) - uHead;
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        static constexpr size_t capacity() {
+            return t_uSize;
+        }
+
+    protected:
+        /**
+         * Index owned by one side and its cached copy of the other side's index.
+         */
+        struct alignas(Internal::s_uCacheLineSize) CSide {
+            std::atomic<size_t> m_uIndex{0};
+            size_t m_uCached{0};
+        };
+
+        CSide m_Producer;
+        CSide m_Consumer;
+        alignas(Internal::s_uCacheLineSize) Internal::CContainer<t_tType, t_uSize, false, void> m_Storage;
+
+        template<typename t_tAssign>
+        inline bool TryPush(t_tAssign Assign) {
+            size_t uTail = m_Producer.m_uIndex.load(std::memory_order_relaxed);
+            if (Free(uTail, 1) == 0) {
+                return false;
+            }
+
+            Assign(m_Storage[uTail % t_uSize]);
+            m_Producer.m_uIndex.store(uTail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Free slots seen by the producer, the consumer's index is only reloaded if the cached one
+         * leaves less than uWanted slots.
+         */
+        inline size_t Free(size_t uTail, size_t uWanted) {
+            size_t uFree = t_uSize - (uTail - m_Producer.m_uCached);
+            if (uFree < uWanted) {
+                m_Producer.m_uCached = m_Consumer.m_uIndex.load(std::memory_order_acquire);
+                uFree = t_uSize - (uTail - m_Producer.m_uCached);
+            }
+            return uFree;
+        }
+
+        /**
+         * Items seen by the consumer, the producer's index is only reloaded if the cached one
+         * shows less than uWanted items.
+         */
+        inline size_t Available(size_t uHead, size_t uWanted) {
+            size_t uAvailable = m_Consumer.m_uCached - uHead;
+            if (uAvailable < uWanted) {
+                m_Consumer.m_uCached = m_Producer.m_uIndex.load(std::memory_order_acquire);
+                uAvailable = m_Consumer.m_uCached - uHead;
+            }
+            return uAvailable;
+        }
+    };
+
+    /**
+     * Bounded lock-free multi producer, multi consumer queue of t_uSize slots.
+     * <br/><br/>
+     * Each slot carries a sequence number telling which position it is free or full for: the producer of the
+     * position p waits for the sequence p, stores the item and publishes p + 1, the consumer of p waits for
+     * p + 1, moves the item out and frees the slot for the next lap with p + t_uSize. The head and tail
+     * positions are on their own cache lines, the slots are a static container so nothing is allocated
+     * after construction.
+     * <br/><br/>
+     * The try_ functions claim positions with a compare and swap and fail instead of waiting, the blocking ones
+     * take their positions with a fetch_add and sleep on the slot's sequence until it is ready. Both may be
+     * mixed on the same queue.
+     * @tparam t_tType Item type, default constructible and move assignable.
+     * @tparam t_uSize Amount of slots, at least 2.
+     */
+    template<typename t_tType, size_t t_uSize>
+    requires(t_uSize > 1 && std::is_default_constructible_v<t_tType> && std::is_move_assignable_v<t_tType>)
+    class CQueueMPMC {
+    public:
+        CQueueMPMC() {
+            for (size_t i = 0; i < t_uSize; ++i) {
+                m_Slots[i].m_uSequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        CQueueMPMC(const CQueueMPMC &) = delete;
+
+        CQueueMPMC &operator=(const CQueueMPMC &) = delete;
+
+        /**
+         * Fails if the queue is full.
+         */
+        bool try_push(const t_tType &Item) {
+            return try_push_n(std::span<const t_tType>{&Item, 1}) == 1;
+        }
+
+        bool try_push(t_tType &&Item) {
+            auto [uTail, uCount] = Claim(m_uTail, 0, 1);
+            if (uCount == 0) {
+                return false;
+            }
+
+            CSlot &Slot = m_Slots[uTail % t_uSize];
+            Slot.m_Item = std::move(Item);
+            Publish(Slot, uTail + 1);
+            return true;
+        }
+
+        /**
+         * Copies the longest prefix of spanItems whose slots are free, their positions are claimed at once.
+         * @return The amount of pushed items.
+         */
+        size_t try_push_n(std::span<const t_tType> spanItems) {
+            auto [uTail, uCount] = Claim(m_uTail, 0, spanItems.size());
+            for (size_t i = 0; i < uCount; ++i) {
+                CSlot &Slot = m_Slots[(uTail + i) % t_uSize];
+                Slot.m_Item = spanItems[i];
+                Publish(Slot, uTail + i + 1);
+            }
+            return uCount;
+        }
+
+        /**
+         * Empty if the queue is empty.
+         */
+        std::optional<t_tType> try_pop() {
+            std::optional<t_tType> RtnVal{};
+            auto [uHead, uCount] = Claim(m_uHead, 1, 1);
+            if (uCount != 0) {
+                CSlot &Slot = m_Slots[uHead % t_uSize];
+                RtnVal.emplace(std::move(Slot.m_Item));
+                Publish(Slot, uHead + t_uSize);
+            }
+            return RtnVal;
+        }
+
+        /**
+         * Moves up to spanItems.size() consecutive items, their positions are claimed at once.
+         * @return The amount of popped items.
+         */
+        size_t try_pop_n(std::span<t_tType> spanItems) {
+            auto [uHead, uCount] = Claim(m_uHead, 1, spanItems.size());
+            for (size_t i = 0; i < uCount; ++i) {
+                CSlot &Slot = m_Slots[(uHead + i) % t_uSize];
+                spanItems[i] = std::move(Slot.m_Item);
+                Publish(Slot, uHead + i + t_uSize);
+            }
+            return uCount;
+        }
+
+        /**
+         * Waits until the item's slot is free.
+         */
+        void push(const t_tType &Item) {
+            push_n(std::span<const t_tType>{&Item, 1});
+        }
+
+        void push(t_tType &&Item) {
+            size_t uTail = m_uTail.fetch_add(1, std::memory_order_relaxed);
+            CSlot &Slot = Wait(uTail, uTail);
+            Slot.m_Item = std::move(Item);
+            Publish(Slot, uTail + 1);
+        }
+
+        /**
+         * Takes spanItems.size() consecutive positions and copies the items as their slots become free.
+         */
+        void push_n(std::span<const t_tType> spanItems) {
+            size_t uTail = m_uTail.fetch_add(spanItems.size(), std::memory_order_relaxed);
+            for (size_t i = 0; i < spanItems.size(); ++i) {
+                CSlot &Slot = Wait(uTail + i, uTail + i);
+                Slot.m_Item = spanItems[i];
+                Publish(Slot, uTail + i + 1);
+            }
+        }
+
+        /**
+         * Waits until an item is available.
+         */
+        t_tType pop() {
+            size_t uHead = m_uHead.fetch_add(1, std::memory_order_relaxed);
+            CSlot &Slot = Wait(uHead, uHead + 1);
+            t_tType Item = std::move(Slot.m_Item);
+            Publish(Slot, uHead + t_uSize);
+            return Item;
+        }
+
+        /**
+         * Takes spanItems.size() consecutive positions and moves the items out as they are pushed.
+         */
+        void pop_n(std::span<t_tType> spanItems) {
+            size_t uHead = m_uHead.fetch_add(spanItems.size(), std::memory_order_relaxed);
+            for (size_t i = 0; i < spanItems.size(); ++i) {
+                CSlot &Slot = Wait(uHead + i, uHead + i + 1);
+                spanItems[i] = std::move(Slot.m_Item);
+                Publish(Slot, uHead + i + t_uSize);
+            }
+        }
+
+        /**
+         * Amount of queued items, only a hint while other threads push or pop.
+         * The blocking functions may take positions ahead of the items, the result is clamped to [0, capacity()].
+         */
+        size_t size() const {
+            size_t uHead = m_uHead.load(std::memory_order_acquire);
+            auto iCount = static_cast<std::ptrdiff_t>(m_uTail.load(std::memory_order_acquire) - uHead);
+            return std::min(static_cast<size_t>(std::max<std::ptrdiff_t>(iCount, 0)), t_uSize);
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        static constexpr size_t capacity() {
+            return t_uSize;
+        }
+
+    protected:
+        struct CSlot {
+            std::atomic<size_t> m_uSequence{0};
+            t_tType m_Item{};
+        };
+
+        alignas(Internal::s_uCacheLineSize) std::atomic<size_t> m_uTail{0};
+        alignas(Internal::s_uCacheLineSize) std::atomic<size_t> m_uHead{0};
+        alignas(Internal::s_uCacheLineSize) Internal::CContainer<CSlot, t_uSize, false, void> m_Slots;
+
+        /**
+         * Claims up to uWanted consecutive positions from Index, stopping at the first slot whose
+         * sequence isn't its position plus uOffset, 0 for the producers and 1 for the consumers.
+         * @return The first claimed position and the amount of claimed positions, 0 if the queue is full or empty.
+         */
+        std::pair<size_t, size_t> Claim(std::atomic<size_t> &Index, size_t uOffset, size_t uWanted) {
+            size_t uPos = Index.load(std::memory_order_relaxed);
+            while (uWanted > 0) {
+                size_t uCount = 0;
+                while (uCount < uWanted &&
+                       m_Slots[(uPos + uCount) % t_uSize].m_uSequence.load(std::memory_order_acquire) ==
+                       uPos + uCount + uOffset) {
+                    ++uCount;
+                }
+                if (uCount == 0) {
+                    // The slot is behind if the queue is full or empty, ahead if another thread took the position
+                    size_t uNow = Index.load(std::memory_order_relaxed);
+                    if (uNow == uPos) {
+                        break;
+                    }
+                    uPos = uNow;
+                } else if (Index.compare_exchange_weak(uPos, uPos + uCount, std::memory_order_relaxed)) {
+                    return {uPos, uCount};
+                }
+            }
+            return {uPos, 0};
+        }
+
+        /**
+         * Sleeps until the sequence of the slot holding uPos reaches uSequence.
+         */
+        inline CSlot &Wait(size_t uPos, size_t uSequence) {
+            CSlot &Slot = m_Slots[uPos % t_uSize];
+            size_t uCurrent;
+            while ((uCurrent = Slot.m_uSequence.load(std::memory_order_acquire)) != uSequence) {
+                Slot.m_uSequence.wait(uCurrent, std::memory_order_relaxed);
+            }
+            return Slot;
+        }
+
+        inline void Publish(CSlot &Slot, size_t uSequence) {
+            Slot.m_uSequence.store(uSequence, std::memory_order_release);
+            Slot.m_uSequence.notify_all();
+        }
+    };
+}
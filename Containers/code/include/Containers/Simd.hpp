@@ -0,0 +1,334 @@
+/**
+ * @file Simd.hpp
+ * @brief Vectorised reductions and searches over contiguous lists of arithmetic types.
+ * @version 0.0.1
+ * @date 2023-01-21
+ *
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define EHO_SIMD_X86 1
+#else
+#define EHO_SIMD_X86 0
+#endif
+
+namespace eho::Simd {
+    /**
+     * Instruction sets the kernels are compiled for, ordered from the oldest.
+     * Scalar is the baseline target of the build, the compiler may still vectorise it.
+     */
+    enum class ELevel {
+        Scalar,
+        SSE,
+        AVX2,
+        AVX512
+    };
+
+    /**
+     * Element types of the kernels.
+     */
+    template<typename t_tType>
+    concept Arithmetic = std::is_arithmetic_v<t_tType> && !std::same_as<t_tType, bool>;
+
+    /**
+     * Best instruction set supported by the running CPU, detected once.
+     */
+    inline ELevel level() {
+        static const ELevel s_eLevel = []() {
+#if EHO_SIMD_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl")) {
+                return ELevel::AVX512;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return ELevel::AVX2;
+            }
+            if (__builtin_cpu_supports("sse4.2")) {
+                return ELevel::SSE;
+            }
+#endif
+            return ELevel::Scalar;
+        }();
+        return s_eLevel;
+    }
+}
+
+namespace eho::Internal {
+    /**
+     * Elements per block of the kernels, two AVX-512 registers. The inner loops over a block have
+     * a constant trip count and independent lanes, so the compiler turns them into vector instructions
+     * of the target the kernel is inlined into, without reassociating the floating point operations.
+     */
+    template<typename t_tType>
+    inline constexpr size_t s_uSimdLanes = 128 / sizeof(t_tType);
+
+    /**
+     * Unsigned integer of the element's size, the match counters and masks are kept in lanes of this width.
+     */
+    template<typename t_tType>
+    using SimdMask = std::conditional_t<sizeof(t_tType) == 1, uint8_t, std::conditional_t<
+            sizeof(t_tType) == 2, uint16_t, std::conditional_t<sizeof(t_tType) == 4, uint32_t, uint64_t>>>;
+
+    template<typename t_tType>
+    struct CSumKernel {
+        [[gnu::always_inline]] static inline t_tType Run(const t_tType *pData, size_t uSize) {
+            constexpr size_t uLanes = s_uSimdLanes<t_tType>;
+            t_tType arAcc[uLanes] = {};
+            size_t i = 0;
+            for (; i + uLanes <= uSize; i += uLanes) {
+                for (size_t j = 0; j < uLanes; ++j) {
+                    arAcc[j] += pData[i + j];
+                }
+            }
+            t_tType Sum{};
+            for (size_t j = 0; j < uLanes; ++j) {
+                Sum += arAcc[j];
+            }
+            for (; i < uSize; ++i) {
+                Sum += pData[i];
+            }
+            return Sum;
+        }
+    };
+
+    /**
+     * Smallest and largest elements of a non empty buffer, a disabled side is left at the first element.
+     */
+    template<typename t_tType, bool t_bMin, bool t_bMax>
+    struct CMinMaxKernel {
+        [[gnu::always_inline]] static inline std::pair<t_tType, t_tType> Run(const t_tType *pData, size_t uSize) {
+            constexpr size_t uLanes = s_uSimdLanes<t_tType>;
+            t_tType arMin[uLanes];
+            t_tType arMax[uLanes];
+            for (size_t j = 0; j < uLanes; ++j) {
+                arMin[j] = pData[0];
+                arMax[j] = pData[0];
+            }
+            size_t i = 0;
+            for (; i + uLanes <= uSize; i += uLanes) {
+                for (size_t j = 0; j < uLanes; ++j) {
+                    if constexpr (t_bMin) {
+                        arMin[j] = pData[i + j] < arMin[j] ? pData[i + j] : arMin[j];
+                    }
+                    if constexpr (t_bMax) {
+                        arMax[j] = arMax[j] < pData[i + j] ? pData[i + j] : arMax[j];
+                    }
+                }
+            }
+            for (; i < uSize; ++i) {
+                arMin[0] = pData[i] < arMin[0] ? pData[i] : arMin[0];
+                arMax[0] = arMax[0] < pData[i] ? pData[i] : arMax[0];
+            }
+            for (size_t j = 1; j < uLanes; ++j) {
+                arMin[0] = arMin[j] < arMin[0] ? arMin[j] : arMin[0];
+                arMax[0] = arMax[0] < arMax[j] ? arMax[j] : arMax[0];
+            }
+            return {arMin[0], arMax[0]};
+        }
+    };
+
+    template<typename t_tType>
+    struct CCountKernel {
+        [[gnu::always_inline]] static inline size_t Run(const t_tType *pData, size_t uSize, t_tType Value) {
+            using Mask = SimdMask<t_tType>;
+            constexpr size_t uLanes = s_uSimdLanes<t_tType>;
+            // The narrow counters are flushed before they can overflow
+            constexpr size_t uFlush = std::numeric_limits<Mask>::max();
+            size_t uCount = 0;
+            size_t i = 0;
+            while (i + uLanes <= uSize) {
+                Mask arCount[uLanes] = {};
+                for (size_t uBlocks = 0; uBlocks < uFlush && i + uLanes <= uSize; ++uBlocks, i += uLanes) {
+                    for (size_t j = 0; j < uLanes; ++j) {
+                        arCount[j] += static_cast<Mask>(pData[i + j] == Value);
+                    }
+                }
+                for (size_t j = 0; j < uLanes; ++j) {
+                    uCount += arCount[j];
+                }
+            }
+            for (; i < uSize; ++i) {
+                uCount += pData[i] == Value;
+            }
+            return uCount;
+        }
+    };
+
+    /**
+     * Index of the first element equal to Value, or uSize. Each block is tested at once
+     * and only the block holding a match is scanned element by element.
+     */
+    template<typename t_tType>
+    struct CFindKernel {
+        [[gnu::always_inline]] static inline size_t Run(const t_tType *pData, size_t uSize, t_tType Value) {
+            using Mask = SimdMask<t_tType>;
+            constexpr size_t uLanes = s_uSimdLanes<t_tType>;
+            size_t i = 0;
+            for (; i + uLanes <= uSize; i += uLanes) {
+                Mask uAny = 0;
+                for (size_t j = 0; j < uLanes; ++j) {
+                    uAny |= static_cast<Mask>(pData[i + j] == Value);
+                }
+                if (uAny != 0) {
+                    break;
+                }
+            }
+            for (; i < uSize; ++i) {
+                if (pData[i] == Value) {
+                    return i;
+                }
+            }
+            return uSize;
+        }
+    };
+
+#if EHO_SIMD_X86
+    /**
+     * The kernel inlined into a function compiled for the instruction set.
+     */
+    template<typename t_tKernel, typename... t_tArgs>
+    __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl"))) auto RunAVX512(t_tArgs... Args) {
+        return t_tKernel::Run(Args...);
+    }
+
+    template<typename t_tKernel, typename... t_tArgs>
+    __attribute__((target("avx2"))) auto RunAVX2(t_tArgs... Args) {
+        return t_tKernel::Run(Args...);
+    }
+
+    template<typename t_tKernel, typename... t_tArgs>
+    __attribute__((target("sse4.2"))) auto RunSSE(t_tArgs... Args) {
+        return t_tKernel::Run(Args...);
+    }
+#endif
+
+    /**
+     * Runs the kernel compiled for eLevel, lowered to what the CPU supports.
+     */
+    template<typename t_tKernel, typename... t_tArgs>
+    auto RunSimd(Simd::ELevel eLevel, t_tArgs... Args) {
+#if EHO_SIMD_X86
+        switch (std::min(eLevel, Simd::level())) {
+            case Simd::ELevel::AVX512:
+                return RunAVX512<t_tKernel>(Args...);
+            case Simd::ELevel::AVX2:
+                return RunAVX2<t_tKernel>(Args...);
+            case Simd::ELevel::SSE:
+                return RunSSE<t_tKernel>(Args...);
+            case Simd::ELevel::Scalar:
+                break;
+        }
+#endif
+        return t_tKernel::Run(Args...);
+    }
+}
+
+/**
+ * Data parallel operations on contiguous ranges of arithmetic types, e.g. CList, CListStatic, CListAligned
+ * or an IListView of them. The kernels are compiled for AVX-512, AVX2 and SSE4.2 and the best one the CPU
+ * supports is picked at runtime, eLevel caps it, e.g. to compare the instruction sets.
+ * <br/><br/>
+ * The floating point sums are computed in 128 bytes worth of interleaved partial sums, so they may differ
+ * from a sequential sum in the last bits. A NaN is ignored by min() and max() unless it is the first element.
+ */
+namespace eho::Simd {
+    template<std::ranges::contiguous_range t_tRange>
+    requires Arithmetic<std::ranges::range_value_t<t_tRange>>
+    std::ranges::range_value_t<t_tRange> sum(const t_tRange &Range, ELevel eLevel = level()) {
+        using Type = std::ranges::range_value_t<t_tRange>;
+        return Internal::RunSimd<Internal::CSumKernel<Type>>(eLevel, std::ranges::data(Range),
+                                                             std::ranges::size(Range));
+    }
+
+    /**
+     * Empty if Range is empty.
+     */
+    template<std::ranges::contiguous_range t_tRange>
+    requires Arithmetic<std::ranges::range_value_t<t_tRange>>
+    std::optional<std::ranges::range_value_t<t_tRange>> min(const t_tRange &Range, ELevel eLevel = level()) {
+        using Type = std::ranges::range_value_t<t_tRange>;
+        std::optional<Type> RtnVal{};
+        if (!std::ranges::empty(Range)) {
+            RtnVal.emplace(Internal::RunSimd<Internal::CMinMaxKernel<Type, true, false>>(
+                    eLevel, std::ranges::data(Range), std::ranges::size(Range)).first);
+        }
+        return RtnVal;
+    }
+
+    /**
+     * Empty if Range is empty.
+     */
+    template<std::ranges::contiguous_range t_tRange>
+    requires Arithmetic<std::ranges::range_value_t<t_tRange>>
+    std::optional<std::ranges::range_value_t<t_tRange>> max(const t_tRange &Range, ELevel eLevel = level()) {
+        using Type = std::ranges::range_value_t<t_tRange>;
+        std::optional<Type> RtnVal{};
+        if (!std::ranges::empty(Range)) {
+            RtnVal.emplace(Internal::RunSimd<Internal::CMinMaxKernel<Type, false, true>>(
+                    eLevel, std::ranges::data(Range), std::ranges::size(Range)).second);
+        }
+        return RtnVal;
+    }
+
+    /**
+     * Smallest and largest elements in a single pass, empty if Range is empty.
+     */
+    template<std::ranges::contiguous_range t_tRange, typename t_tType = std::ranges::range_value_t<t_tRange>>
+    requires Arithmetic<t_tType>
+    std::optional<std::pair<t_tType, t_tType>> minmax(const t_tRange &Range, ELevel eLevel = level()) {
+        std::optional<std::pair<t_tType, t_tType>> RtnVal{};
+        if (!std::ranges::empty(Range)) {
+            RtnVal.emplace(Internal::RunSimd<Internal::CMinMaxKernel<t_tType, true, true>>(
+                    eLevel, std::ranges::data(Range), std::ranges::size(Range)));
+        }
+        return RtnVal;
+    }
+
+    /**
+     * Amount of elements equal to Value.
+     */
+    template<std::ranges::contiguous_range t_tRange, typename t_tType = std::ranges::range_value_t<t_tRange>>
+    requires Arithmetic<t_tType>
+    size_t count(const t_tRange &Range, std::type_identity_t<t_tType> Value, ELevel eLevel = level()) {
+        return Internal::RunSimd<Internal::CCountKernel<t_tType>>(eLevel, std::ranges::data(Range),
+                                                                  std::ranges::size(Range), Value);
+    }
+
+    /**
+     * First element equal to Value, or the end of Range.
+     */
+    template<std::ranges::contiguous_range t_tRange, typename t_tType = std::ranges::range_value_t<t_tRange>>
+    requires Arithmetic<t_tType>
+    std::ranges::iterator_t<t_tRange> find(t_tRange &Range, std::type_identity_t<t_tType> Value,
+                                           ELevel eLevel = level()) {
+        size_t uIndex = Internal::RunSimd<Internal::CFindKernel<t_tType>>(eLevel, std::ranges::data(Range),
+                                                                          std::ranges::size(Range), Value);
+        return std::ranges::begin(Range) + static_cast<std::ptrdiff_t>(uIndex);
+    }
+
+    template<std::ranges::contiguous_range t_tRange, typename t_tType = std::ranges::range_value_t<t_tRange>>
+    requires Arithmetic<t_tType>
+    bool contains(const t_tRange &Range, std::type_identity_t<t_tType> Value, ELevel eLevel = level()) {
+        return Internal::RunSimd<Internal::CFindKernel<t_tType>>(eLevel, std::ranges::data(Range),
+                                                                 std::ranges::size(Range), Value) !=
+               std::ranges::size(Range);
+    }
+}
@@ -15,9 +15,165 @@
 
 #include <iterator>
 #include <memory>
-#include <functional>
+#include <memory_resource>
+#include <algorithm>
+#include <utility>
+#include <tuple>
+#include <new>
+#include <cstddef>
+#include <cstdlib>
+#include <concepts>
+#include <cstring>
+#include <type_traits>
+#include <bit>
+#include <compare>
+#include "GrowthPolicy.hpp"
+
+namespace eho {
+    /**
+     * Types whose objects can be moved to another address with memcpy/memmove, leaving nothing
+     * to destroy at the source. Trivially copyable types are relocatable, other types can opt in
+     * by specializing this trait, e.g. types holding a std::unique_ptr.
+     */
+    template<typename t_tType>
+    struct is_trivially_relocatable : std::is_trivially_copyable<t_tType> {
+    };
+
+    template<typename t_tType>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<t_tType>::value;
+
+    /**
+     * The standard allocators are empty or a single pointer.
+     */
+    template<typename t_tType>
+    struct is_trivially_relocatable<std::allocator<t_tType>> : std::true_type {
+    };
+
+    template<typename t_tType>
+    struct is_trivially_relocatable<std::pmr::polymorphic_allocator<t_tType>> : std::true_type {
+    };
+
+    /**
+     * Allocators that can resize an allocation, moving its bytes if needed.
+     * The dynamic containers use it to grow trivially relocatable elements without moving them one by one.
+     */
+    template<typename t_tAllocator>
+    concept ReallocatableAllocator = requires(t_tAllocator Allocator, typename t_tAllocator::value_type *ptr,
+                                              size_t uSize) {
+        { Allocator.reallocate(ptr, uSize, uSize) } -> std::same_as<typename t_tAllocator::value_type *>;
+    };
+
+    /**
+     * Alignment of the buffers returned by an allocator, over-aligning allocators declare it
+     * with a static alignment member. Their allocations are also padded to whole multiples of it.
+     */
+    template<typename t_tAllocator>
+    inline constexpr size_t allocator_alignment_v = alignof(typename t_tAllocator::value_type);
+
+    template<typename t_tAllocator> requires requires { t_tAllocator::alignment; }
+    inline constexpr size_t allocator_alignment_v<t_tAllocator> = t_tAllocator::alignment;
+}
 
 namespace eho::Internal {
+    /**
+     * Cache line size assumed by the containers' layout.
+     */
+    inline constexpr size_t s_uCacheLineSize = 64;
+
+    /**
+     * Hints the CPU to fetch the cache line at ptr, it is a no-op if the compiler has no prefetch builtin.
+     */
+    inline void Prefetch(const void *ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(ptr);
+#endif
+    }
+
+    /**
+     * std::uninitialized_move that can be used in constant expressions.
+     */
+    template<typename t_tType>
+    constexpr void UninitializedMove(t_tType *pFirst, t_tType *pLast, t_tType *pDest) {
+        if (std::is_constant_evaluated()) {
+            for (; pFirst != pLast; ++pFirst, ++pDest) {
+                std::construct_at(pDest, std::move(*pFirst));
+            }
+        } else {
+            std::uninitialized_move(pFirst, pLast, pDest);
+        }
+    }
+
+    /**
+     * Moves uCount initialized elements to the uninitialized pDest, the source is left uninitialized.
+     * Collapses into a memcpy for trivially relocatable types.
+     */
+    template<typename t_tType>
+    constexpr void Relocate(t_tType *pSource, size_t uCount, t_tType *pDest) {
+        if constexpr (is_trivially_relocatable_v<t_tType>) {
+            if (!std::is_constant_evaluated()) {
+                if (uCount != 0) {
+                    std::memcpy(static_cast<void *>(pDest), static_cast<const void *>(pSource),
+                                uCount * sizeof(t_tType));
+                }
+                return;
+            }
+        }
+
+        UninitializedMove(pSource, pSource + uCount, pDest);
+        std::destroy_n(pSource, uCount);
+    }
+
+    /**
+     * Shifts the uCount initialized elements at pFirst uBy slots to the right,
+     * the uBy slots starting at pFirst are left uninitialized.
+     * Collapses into a memmove for trivially relocatable types.
+     */
+    template<typename t_tType>
+    constexpr void ShiftRight(t_tType *pFirst, size_t uCount, size_t uBy = 1) {
+        if (uCount == 0 || uBy == 0) {
+            return;
+        }
+
+        if constexpr (is_trivially_relocatable_v<t_tType>) {
+            if (!std::is_constant_evaluated()) {
+                std::memmove(static_cast<void *>(pFirst + uBy), static_cast<const void *>(pFirst),
+                             uCount * sizeof(t_tType));
+                return;
+            }
+        }
+
+        // The last elements land on uninitialized slots, the others are assigned
+        size_t uTail = std::min(uBy, uCount);
+        UninitializedMove(pFirst + uCount - uTail, pFirst + uCount, pFirst + uCount + uBy - uTail);
+        std::move_backward(pFirst, pFirst + uCount - uTail, pFirst + uCount);
+        std::destroy_n(pFirst, uTail);
+    }
+
+    /**
+     * Shifts the uCount initialized elements after the uBy uninitialized slots at pHole uBy slots to the left,
+     * the last uBy slots are left uninitialized. Collapses into a memmove for trivially relocatable types.
+     */
+    template<typename t_tType>
+    constexpr void ShiftLeft(t_tType *pHole, size_t uCount, size_t uBy = 1) {
+        if (uCount == 0 || uBy == 0) {
+            return;
+        }
+
+        if constexpr (is_trivially_relocatable_v<t_tType>) {
+            if (!std::is_constant_evaluated()) {
+                std::memmove(static_cast<void *>(pHole), static_cast<const void *>(pHole + uBy),
+                             uCount * sizeof(t_tType));
+                return;
+            }
+        }
+
+        // The first elements land on uninitialized slots, the others are assigned
+        size_t uHead = std::min(uBy, uCount);
+        UninitializedMove(pHole + uBy, pHole + uBy + uHead, pHole);
+        std::move(pHole + uBy + uHead, pHole + uBy + uCount, pHole + uHead);
+        std::destroy_n(pHole + uCount + uBy - uHead, uHead);
+    }
+
     template<typename t_tType>
     class CIterator {
         // thanks: https://stackoverflow.com/questions/69890176/create-contiguous-iterator-for-custom-class
@@ -30,42 +186,42 @@ namespace eho::Internal {
         using reference = t_tType &;
 
         // constructor for Array<T,S>::begin() and Array<T,S>::end()
-        CIterator(pointer ptr) : m_Ptr(ptr) {}
+        constexpr CIterator(pointer ptr) : m_Ptr(ptr) {}
 
         // std::weakly_incrementable<I>
-        CIterator &operator++() {
+        constexpr CIterator &operator++() {
             ++m_Ptr;
             return *this;
         }
 
-        CIterator operator++(int) {
+        constexpr CIterator operator++(int) {
             CIterator tmp = *this;
             ++(*this);
             return tmp;
         }
 
-        CIterator() : m_Ptr(nullptr/*&mArray[0]*/) {} // TODO: Unsure which is correct!
+        constexpr CIterator() : m_Ptr(nullptr/*&mArray[0]*/) {} // TODO: Unsure which is correct!
 
         // std::input_or_output_iterator<I>
-        reference operator*() { return *m_Ptr; }
+        constexpr reference operator*() { return *m_Ptr; }
 
         // std::indirectly_readable<I>
-        friend reference operator*(const CIterator &it) { return *(it.m_Ptr); }
+        friend constexpr reference operator*(const CIterator &it) { return *(it.m_Ptr); }
 
         // std::input_iterator<I>
         // No actions were needed here!
 
         // std::forward_iterator<I>
         // In C++20, 'operator==' implies 'operator!='
-        bool operator==(const CIterator &it) const { return m_Ptr == it.m_Ptr; }
+        constexpr bool operator==(const CIterator &it) const { return m_Ptr == it.m_Ptr; }
 
         // std::bidirectional_iterator<I>
-        CIterator &operator--() {
+        constexpr CIterator &operator--() {
             --m_Ptr;
             return *this;
         }
 
-        CIterator operator--(int) {
+        constexpr CIterator operator--(int) {
             CIterator tmp = *this;
             --(*this);
             return tmp;
@@ -73,41 +229,41 @@ namespace eho::Internal {
 
         // std::random_access_iterator<I>
         //     std::totally_ordered<I>
-        std::weak_ordering operator<=>(const CIterator &it) const {
+        constexpr std::weak_ordering operator<=>(const CIterator &it) const {
             return std::compare_three_way{}(m_Ptr, it.m_Ptr);
             // alternatively: `return mPtr <=> it.mPtr;`
         }
 
         //     std::sized_sentinel_for<I, I>
-        difference_type operator-(const CIterator &it) const { return m_Ptr - it.m_Ptr; }
+        constexpr difference_type operator-(const CIterator &it) const { return m_Ptr - it.m_Ptr; }
 
         //     std::iter_difference<I> operators
-        CIterator &operator+=(difference_type diff) {
+        constexpr CIterator &operator+=(difference_type diff) {
             m_Ptr += diff;
             return *this;
         }
 
-        CIterator &operator-=(difference_type diff) {
+        constexpr CIterator &operator-=(difference_type diff) {
             m_Ptr -= diff;
             return *this;
         }
 
-        CIterator operator+(difference_type diff) const { return CIterator(m_Ptr + diff); }
+        constexpr CIterator operator+(difference_type diff) const { return CIterator(m_Ptr + diff); }
 
-        CIterator operator-(difference_type diff) const { return CIterator(m_Ptr - diff); }
+        constexpr CIterator operator-(difference_type diff) const { return CIterator(m_Ptr - diff); }
 
-        friend CIterator operator+(difference_type diff, const CIterator &it) {
+        friend constexpr CIterator operator+(difference_type diff, const CIterator &it) {
             return it + diff;
         }
 
-        friend CIterator operator-(difference_type diff, const CIterator &it) {
+        friend constexpr CIterator operator-(difference_type diff, const CIterator &it) {
             return it - diff;
         }
 
-        reference operator[](difference_type diff) const { return m_Ptr[diff]; }
+        constexpr reference operator[](difference_type diff) const { return m_Ptr[diff]; }
 
         // std::contiguous_iterator<I>
-        pointer operator->() const { return m_Ptr; }
+        constexpr pointer operator->() const { return m_Ptr; }
 
         using element_type = t_tType;
 
@@ -115,7 +271,16 @@ namespace eho::Internal {
         t_tType *m_Ptr;
     };
 
-    template<typename t_tType, size_t t_uSize, bool t_bLinked, bool t_bAmortized>
+    /**
+     * @tparam t_tType Container's data type.
+     * @tparam t_uSize Container's size, 0 for dynamic containers.
+     * @tparam t_bLinked If the dynamic container is a linked list.
+     * @tparam t_tGrowth Growth policy of the dynamic containers, void for the static ones
+     * and Growth::CFixed for the fixed capacity ones.
+     * @tparam t_tAllocator Allocator of the dynamic containers, ignored by the ones that never allocate.
+     */
+    template<typename t_tType, size_t t_uSize, bool t_bLinked, typename t_tGrowth,
+            typename t_tAllocator = std::allocator<t_tType>>
     class CContainer;
 
     /**
@@ -124,8 +289,8 @@ namespace eho::Internal {
      * @tparam t_tType Container's data type.
      * @tparam t_uSize Container's size.
      */
-    template<typename t_tType, size_t t_uSize> requires(t_uSize > 0)
-    class CContainer<t_tType, t_uSize, false, false> {
+    template<typename t_tType, size_t t_uSize, typename t_tAllocator> requires(t_uSize > 0)
+    class CContainer<t_tType, t_uSize, false, void, t_tAllocator> {
     public:
         using Iterator = CIterator<t_tType>;
         //https://stackoverflow.com/questions/3582608/how-to-correctly-implement-custom-iterators-and-const-iterators
@@ -194,140 +359,431 @@ namespace eho::Internal {
         static_assert(std::contiguous_iterator<ConstIterator>);
     };
 
+    /**
+     * Amount of elements readable in a buffer of uCapacity elements padded to whole multiples of uAlignment bytes.
+     */
+    inline constexpr size_t PaddedSize(size_t uCapacity, size_t uSize, size_t uAlignment) {
+        return ((uCapacity * uSize + uAlignment - 1) & ~(uAlignment - 1)) / uSize;
+    }
+
+    /**
+     * Uninitialized in-object storage for t_uSize elements.
+     * The elements are constructed and destroyed by the owner, the union keeps it usable in constant expressions.
+     * @tparam t_uAlignment Alignment of the buffer, it is padded to a whole multiple of it.
+     */
+    template<typename t_tType, size_t t_uSize, size_t t_uAlignment = alignof(t_tType)>
+    struct CInlineBuffer {
+        constexpr CInlineBuffer() {}
+
+        constexpr ~CInlineBuffer() {}
+
+        inline constexpr t_tType *Data() { return m_arItems; }
+
+        inline constexpr const t_tType *Data() const { return m_arItems; }
+
+        union {
+            alignas(t_uAlignment) t_tType m_arItems[PaddedSize(t_uSize, sizeof(t_tType), t_uAlignment)];
+        };
+    };
+
+    template<typename t_tType, size_t t_uAlignment>
+    struct CInlineBuffer<t_tType, 0, t_uAlignment> {
+        inline constexpr t_tType *Data() { return nullptr; }
+
+        inline constexpr const t_tType *Data() const { return nullptr; }
+    };
+
     /**
      * Dynamic sized container implementation.
      * It is allocated in contiguous memory.
+     * <br/><br/>
+     * If t_uSize > 0 the first t_uSize elements are kept inside the object,
+     * the storage spills to the heap only when it grows past t_uSize and
+     * returns inside the object when the growth policy shrinks it back.
      * @tparam t_tType
-     * @tparam t_bAmortized
+     * @tparam t_uSize Inline capacity, 0 to always allocate on the heap.
+     * @tparam t_tGrowth Growth policy applied on insertions and removals.
+     * @tparam t_tAllocator Allocator of the heap storage, the elements are constructed through it.
      */
-    template<typename t_tType, bool t_bAmortized>
-    class CContainer<t_tType, 0, false, t_bAmortized> {
+    template<typename t_tType, size_t t_uSize, Growth::GrowthPolicy t_tGrowth, typename t_tAllocator>
+    class CContainer<t_tType, t_uSize, false, t_tGrowth, t_tAllocator> {
+    protected:
+        using AllocatorTraits = std::allocator_traits<t_tAllocator>;
+        static_assert(std::is_same_v<typename AllocatorTraits::value_type, t_tType>);
+
     public:
         using Iterator = CIterator<t_tType>;
         using ConstIterator = CIterator<const t_tType>;
 
+        /**
+         * Alignment of data(), the storage is readable, not writable, up to PaddedSize(size(), ...) elements.
+         */
+        static constexpr size_t s_uAlignment = allocator_alignment_v<t_tAllocator>;
+
     public:
-        CContainer() : m_uSize{0}, m_uInitSize{0}, m_Storage{nullptr, [](t_tType *ptr) {}} {}
+        CContainer() : CContainer(t_tAllocator{}) {}
+
+        explicit CContainer(const t_tAllocator &Allocator) :
+                m_pData{nullptr}, m_uInitSize{0}, m_uSize{t_uSize}, m_Allocator{Allocator} {
+            m_pData = m_Inline.Data();
+        }
+
+        CContainer(CContainer &&Other) noexcept(std::is_nothrow_move_constructible_v<t_tType>) :
+                CContainer(Other.m_Allocator) {
+            Steal(Other);
+        }
+
+        /**
+         * Takes Other's allocation if the allocator propagates or both allocators are equal,
+         * otherwise the elements are moved one by one into this container's allocation.
+         */
+        CContainer &operator=(CContainer &&Other) noexcept(
+                std::is_nothrow_move_constructible_v<t_tType> &&
+                (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                 AllocatorTraits::is_always_equal::value)) {
+            if (this != &Other) {
+                resize(0);
+                if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+                    m_Allocator = Other.m_Allocator;
+                }
+                if (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                    m_Allocator == Other.m_Allocator) {
+                    Steal(Other);
+                } else {
+                    AllocateAndShift(0, 0, Other.m_uInitSize);
+                    for (; m_uInitSize < Other.m_uInitSize; ++m_uInitSize) {
+                        AllocatorTraits::construct(m_Allocator, m_pData + m_uInitSize,
+                                                   std::move(Other.m_pData[m_uInitSize]));
+                    }
+                    Other.resize(0);
+                }
+            }
+            return *this;
+        }
 
         ~CContainer() {
             for (size_t i = 0; i < m_uInitSize; ++i) {
-                std::allocator_traits<decltype(m_Allocator)>::destroy(m_Allocator, &m_Storage[i]);
+                AllocatorTraits::destroy(m_Allocator, m_pData + i);
             }
+            Deallocate(m_pData, m_uSize);
         }
 
-        inline t_tType &operator[](size_t uIndex) { return m_Storage[uIndex]; }
+        inline t_tAllocator get_allocator() const { return m_Allocator; }
+
+        inline t_tType &operator[](size_t uIndex) { return m_pData[uIndex]; }
 
-        inline const t_tType &operator[](size_t uIndex) const { return m_Storage[uIndex]; }
+        inline const t_tType &operator[](size_t uIndex) const { return m_pData[uIndex]; }
 
+        /**
+         * @return The capacity.
+         */
         inline size_t size() const { return m_uSize; }
 
+        /**
+         * @return The amount of initialized elements.
+         */
+        inline size_t count() const { return m_uInitSize; }
+
+        /**
+         * Sets the capacity to exactly uNewSize, the elements past uNewSize are destroyed.
+         * @return The amount of elements in the container.
+         */
         size_t resize(size_t uNewSize) {
-            size_t uSize = 0;
-            if constexpr (t_bAmortized) {
-                uSize = std::max(uNewSize + (uNewSize / 2), m_uSize);
+            if (uNewSize < m_uInitSize) {
+                std::destroy(m_pData + uNewSize, m_pData + m_uInitSize);
+                m_uInitSize = uNewSize;
+            }
+            Reallocate(uNewSize);
+            return m_uInitSize;
+        }
+
+        inline t_tType *data() { return std::assume_aligned<s_uAlignment>(m_pData); }
 
-                if (uSize > uNewSize) {
-                    // We will not deallocate the memory region, but we need to destroy the objects
-                    std::ranges::destroy(this->begin() + uSize, this->end());
+        inline const t_tType *data() const { return std::assume_aligned<s_uAlignment>(m_pData); }
+
+        void insert(t_tType &&Item, size_t uIndex, size_t uShift) {
+            emplace(uIndex, uShift, std::move(Item));
+        }
+
+        void insert(const t_tType &Item, size_t uIndex, size_t uShift) {
+            emplace(uIndex, uShift, Item);
+        }
+
+        /**
+         * Constructs an element from Args in the slot uIndex.
+         * The arguments may reference elements of the container.
+         * @return The new element.
+         */
+        template<typename... t_tArgs>
+        t_tType &emplace(size_t uIndex, size_t uShift, t_tArgs &&... Args) {
+            bool bGrow = (uShift + 1) > m_uSize;
+            if (bGrow && (!s_bReallocatable || IsInline())) {
+                // Build the element in the new allocation, the old one is still valid for the arguments
+                size_t uCapacity = t_tGrowth::Grow(m_uSize, uShift + 1, sizeof(t_tType));
+                t_tType *pNew = Allocate(uCapacity);
+                try {
+                    AllocatorTraits::construct(m_Allocator, pNew + uIndex, std::forward<t_tArgs>(Args)...);
+                } catch (...) {
+                    Deallocate(pNew, uCapacity);
+                    throw;
                 }
+                Relocate(m_pData, uIndex, pNew);
+                Relocate(m_pData + uIndex, uShift - uIndex, pNew + uIndex + 1);
+
+                Deallocate(m_pData, m_uSize);
+                m_pData = pNew;
+                m_uSize = uCapacity;
+                m_uInitSize += 1;
+                return m_pData[uIndex];
+            }
 
+            if (bGrow || uIndex < uShift) {
+                // Growing or shifting moves the elements the arguments may reference
+                t_tType Item(std::forward<t_tArgs>(Args)...);
+                AllocateAndShift(uIndex, uShift);
+                try {
+                    AllocatorTraits::construct(m_Allocator, m_pData + uIndex, std::move(Item));
+                } catch (...) {
+                    ShiftLeft(m_pData + uIndex, uShift - uIndex);
+                    throw;
+                }
             } else {
-                uSize = uNewSize;
+                AllocatorTraits::construct(m_Allocator, m_pData + uIndex, std::forward<t_tArgs>(Args)...);
             }
+            m_uInitSize += 1;
+            return m_pData[uIndex];
+        }
 
-            if (uSize == 0) {
-                m_Storage.reset(nullptr);
-                m_uSize = 0;
-            } else if (uSize != m_uSize) {
-                std::unique_ptr<t_tType[], std::function<void(t_tType *)>> NewStorage{
-                        m_Allocator.allocate(uSize),
-                        std::bind([](t_tType *ptr, std::allocator<t_tType> Allocator, size_t uSize) {
-                            for (size_t i = 0; i < uSize; ++i) {
-//                                std::allocator_traits<decltype(Allocator)>::destroy(Allocator, ptr + i);
-                            }
-                            std::allocator_traits<decltype(Allocator)>::deallocate(Allocator, ptr, uSize);
-                        }, std::placeholders::_1, m_Allocator, uSize)};
-
-                if (m_uSize != 0) {
-                    // Copy one to another
-                    std::ranges::uninitialized_move(Iterator(&m_Storage[0]), Iterator(&m_Storage[m_uSize]),
-                                                    Iterator(&NewStorage[0]), Iterator(&NewStorage[uSize]));
-                }
+        /**
+         * Inserts uCount elements read from First at uIndex, growing and shifting the tail at most once.
+         */
+        template<std::forward_iterator t_tIterator>
+        void insert(t_tIterator First, size_t uCount, size_t uIndex, size_t uShift) {
+            if (uCount == 0) {
+                return;
+            }
 
-                m_Storage.swap(NewStorage);
-                m_uSize = uSize;
-            } else {
-                uSize = m_uSize;
+            AllocateAndShift(uIndex, uShift, uCount);
+            size_t uDone = 0;
+            try {
+                for (; uDone < uCount; ++uDone, ++First) {
+                    AllocatorTraits::construct(m_Allocator, m_pData + uIndex + uDone, *First);
+                }
+            } catch (...) {
+                // Close the gap, the container is left as before the insertion
+                std::destroy_n(m_pData + uIndex, uDone);
+                ShiftLeft(m_pData + uIndex, uShift - uIndex, uCount);
+                throw;
             }
-            return uSize;
+            m_uInitSize += uCount;
         }
 
-        inline t_tType *data() { return m_Storage.get(); }
+        t_tType pop(size_t uIndex, size_t uShift) {
+            t_tType RtnVal{std::move(m_pData[uIndex])};
+            std::destroy_at(m_pData + uIndex);
+            ShiftLeft(m_pData + uIndex, uShift - uIndex - 1);
+            m_uInitSize -= 1;
+            Shrink();
+            return RtnVal;
+        }
 
-        inline const t_tType *data() const { return m_Storage.get(); }
+        /**
+         * Removes the elements in [uFirst, uLast), shifting the tail once.
+         */
+        void erase(size_t uFirst, size_t uLast, size_t uShift) {
+            if (uFirst == uLast) {
+                return;
+            }
 
-        void insert(t_tType &&Item, size_t uIndex, size_t uShift) {
-            m_uInitSize += 1;
-            AllocateAndShift(uIndex, uShift);
-            std::construct_at(&m_Storage[uIndex], std::move(Item));
+            std::destroy(m_pData + uFirst, m_pData + uLast);
+            ShiftLeft(m_pData + uFirst, uShift - uLast, uLast - uFirst);
+            m_uInitSize -= uLast - uFirst;
+            Shrink();
         }
 
-        void insert(const t_tType &Item, size_t uIndex, size_t uShift) {
-            m_uInitSize += 1;
-            AllocateAndShift(uIndex, uShift);
-            std::construct_at(&m_Storage[uIndex], Item);
+        /**
+         * Removes the elements matching Predicate, compacting the kept ones in a single pass.
+         * @return The amount of removed elements.
+         */
+        template<typename t_tPredicate>
+        size_t erase_if(t_tPredicate &Predicate, size_t uShift) {
+            t_tType *pEnd = m_pData + uShift;
+            t_tType *pNewEnd = std::remove_if(m_pData, pEnd, Predicate);
+            auto uRemoved = static_cast<size_t>(pEnd - pNewEnd);
+
+            std::destroy(pNewEnd, pEnd);
+            m_uInitSize -= uRemoved;
+            Shrink();
+            return uRemoved;
         }
 
-        t_tType pop(size_t uIndex, size_t uShift) {
-            t_tType RtnVal{std::move(m_Storage[uIndex])};
-            if (uIndex < uShift) {
-                std::ranges::move(begin() + uIndex + 1, end(), begin() + uIndex);
+        /**
+         * Removes the element uIndex by moving the last element into its slot.
+         */
+        t_tType swap_remove(size_t uIndex, size_t uShift) {
+            t_tType RtnVal{std::move(m_pData[uIndex])};
+            if (uIndex != uShift - 1) {
+                m_pData[uIndex] = std::move(m_pData[uShift - 1]);
             }
-            resize((uShift - 1));
+            std::destroy_at(m_pData + uShift - 1);
+            m_uInitSize -= 1;
+            Shrink();
             return RtnVal;
         }
 
-        Iterator begin() { return Iterator(&m_Storage[0]); }
+        Iterator begin() { return Iterator(m_pData); }
 
-        Iterator end() { return Iterator(&m_Storage[m_uSize]); }
+        Iterator end() { return Iterator(m_pData + m_uSize); }
 
-        ConstIterator begin() const { return ConstIterator(&m_Storage[0]); }
+        ConstIterator begin() const { return ConstIterator(m_pData); }
 
-        ConstIterator end() const { return ConstIterator(&m_Storage[m_uSize]); }
+        ConstIterator end() const { return ConstIterator(m_pData + m_uSize); }
 
         ConstIterator cbegin() const { return begin(); }
 
         ConstIterator cend() const { return end(); }
 
     protected:
-        size_t m_uSize;
+        /**
+         * Trivially relocatable types with fundamental alignment are allocated with malloc,
+         * so the growth can use realloc and expand in place. Only done for the default allocator.
+         */
+        static constexpr bool s_bMalloc =
+                is_trivially_relocatable_v<t_tType> && alignof(t_tType) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__ &&
+                std::is_same_v<t_tAllocator, std::allocator<t_tType>>;
+
+        /**
+         * The growth resizes the allocation in place, with realloc or the allocator's reallocate().
+         */
+        static constexpr bool s_bReallocatable =
+                s_bMalloc || (is_trivially_relocatable_v<t_tType> && ReallocatableAllocator<t_tAllocator>);
+
+        /**
+         * The allocation is owned through a plain pointer, which allocator freed it is known at compile time.
+         * With an empty allocator and no inline buffer the container is a pointer, a size and a capacity.
+         */
+        t_tType *m_pData;
         size_t m_uInitSize;
-        std::allocator<t_tType> m_Allocator;
-        std::unique_ptr<t_tType[], std::function<void(t_tType *)>> m_Storage;
+        size_t m_uSize;
+        [[no_unique_address]] t_tAllocator m_Allocator;
+        [[no_unique_address]] CInlineBuffer<t_tType, t_uSize, s_uAlignment> m_Inline;
+
+        inline bool IsInline() const {
+            return t_uSize > 0 && m_pData == m_Inline.Data();
+        }
+
+        /**
+         * Takes the elements of Other, which is left empty. The container must be empty.
+         */
+        void Steal(CContainer &Other) {
+            if (Other.IsInline()) {
+                Relocate(Other.m_pData, Other.m_uInitSize, m_pData);
+            } else {
+                Deallocate(m_pData, m_uSize);
+                m_pData = std::exchange(Other.m_pData, Other.m_Inline.Data());
+                m_uSize = std::exchange(Other.m_uSize, t_uSize);
+            }
+            m_uInitSize = std::exchange(Other.m_uInitSize, 0);
+        }
 
-        inline void AllocateAndShift(size_t uIndex, size_t uShift) {
-            if ((uShift + 1) > m_uSize) {
-                resize((uShift + 1));
+        inline void AllocateAndShift(size_t uIndex, size_t uShift, size_t uCount = 1) {
+            if ((uShift + uCount) > m_uSize) {
+                Reallocate(t_tGrowth::Grow(m_uSize, uShift + uCount, sizeof(t_tType)));
             }
 
             if (uIndex < uShift) {
-                for (auto it = begin() + uShift; it != (begin() + uIndex); --it) {
-                    std::uninitialized_move(it - 1, it, it);
-                }
+                ShiftRight(m_pData + uIndex, uShift - uIndex, uCount);
+            }
+        }
+
+        /**
+         * Shrinks the allocation if the growth policy asks for it after a removal.
+         */
+        inline void Shrink() {
+            size_t uCapacity = t_tGrowth::Shrink(m_uSize, m_uInitSize, sizeof(t_tType));
+            if (uCapacity < m_uSize) {
+                Reallocate(std::max(uCapacity, m_uInitSize));
             }
         }
 
+        /**
+         * Moves the initialized elements to a new allocation of uCapacity elements.
+         * @param uCapacity Must be at least the amount of initialized elements.
+         */
+        void Reallocate(size_t uCapacity) {
+            if (uCapacity == m_uSize) {
+                return;
+            }
+
+            if constexpr (t_uSize > 0) {
+                if (uCapacity <= t_uSize) {
+                    // Back inside the object
+                    if (!IsInline()) {
+                        Relocate(m_pData, m_uInitSize, m_Inline.Data());
+                        Deallocate(m_pData, m_uSize);
+                        m_pData = m_Inline.Data();
+                    }
+                    m_uSize = t_uSize;
+                    return;
+                }
+            }
+
+            if (uCapacity == 0) {
+                Deallocate(m_pData, m_uSize);
+                m_pData = nullptr;
+                m_uSize = 0;
+                return;
+            }
+
+            if constexpr (s_bReallocatable) {
+                if (!IsInline() && m_pData != nullptr) {
+                    // May expand in place, otherwise the bytes are moved, which is a valid relocation
+                    if constexpr (s_bMalloc) {
+                        void *pNew = std::realloc(static_cast<void *>(m_pData), uCapacity * sizeof(t_tType));
+                        if (pNew == nullptr) {
+                            throw std::bad_alloc{};
+                        }
+                        m_pData = static_cast<t_tType *>(pNew);
+                    } else {
+                        m_pData = m_Allocator.reallocate(m_pData, m_uSize, uCapacity);
+                    }
+                    m_uSize = uCapacity;
+                    return;
+                }
+            }
+
+            t_tType *pNew = Allocate(uCapacity);
+            Relocate(m_pData, m_uInitSize, pNew);
+            Deallocate(m_pData, m_uSize);
+            m_pData = pNew;
+            m_uSize = uCapacity;
+        }
 
-        template<typename T>
-        std::unique_ptr<T[], std::function<void(T *)>> make_T(t_tType *ptr, std::allocator<T> alloc, std::size_t size) {
-            auto deleter = [](T *p, std::allocator<T> alloc, std::size_t size) {
-                for (size_t i = 0; i < size; ++i) {
-//                    alloc.destroy(&p[i]);
+        t_tType *Allocate(size_t uCapacity) {
+            if constexpr (s_bMalloc) {
+                void *pNew = std::malloc(uCapacity * sizeof(t_tType));
+                if (pNew == nullptr) {
+                    throw std::bad_alloc{};
                 }
-                alloc.deallocate(p, size);
-            };
+                return static_cast<t_tType *>(pNew);
+            } else {
+                return AllocatorTraits::allocate(m_Allocator, uCapacity);
+            }
+        }
+
+        /**
+         * Frees an allocation of uCapacity elements, the inline buffer and nullptr are ignored.
+         */
+        void Deallocate(t_tType *pData, size_t uCapacity) {
+            if (pData == nullptr || (t_uSize > 0 && pData == m_Inline.Data())) {
+                return;
+            }
 
-            return {ptr, std::bind(deleter, std::placeholders::_1, alloc, size)};
+            if constexpr (s_bMalloc) {
+                std::free(static_cast<void *>(pData));
+            } else {
+                AllocatorTraits::deallocate(m_Allocator, pData, uCapacity);
+            }
         }
 
     private:
@@ -365,7 +821,1127 @@ namespace eho::Internal {
         static_assert(std::contiguous_iterator<ConstIterator>);
     };
 
-    template<typename t_tType, bool t_bAmortized>
-    class CContainer<t_tType, 0, true, t_bAmortized> {
+    /**
+     * Fixed capacity container implementation.
+     * The t_uSize elements are stored inside the object and constructed on insertion,
+     * it never allocates and can be used in constant expressions.
+     * Inserting past t_uSize throws std::length_error.
+     * @tparam t_tType
+     * @tparam t_uSize Container's capacity.
+     */
+    template<typename t_tType, size_t t_uSize, typename t_tAllocator> requires(t_uSize > 0)
+    class CContainer<t_tType, t_uSize, false, Growth::CFixed, t_tAllocator> {
+    public:
+        using Iterator = CIterator<t_tType>;
+        using ConstIterator = CIterator<const t_tType>;
+
+    public:
+        constexpr CContainer() = default;
+
+        constexpr CContainer(CContainer &&Other) noexcept(std::is_nothrow_move_constructible_v<t_tType>) {
+            Relocate(Other.data(), Other.m_uInitSize, data());
+            m_uInitSize = std::exchange(Other.m_uInitSize, 0);
+        }
+
+        constexpr CContainer &operator=(CContainer &&Other) noexcept(std::is_nothrow_move_constructible_v<t_tType>) {
+            if (this != &Other) {
+                resize(0);
+                Relocate(Other.data(), Other.m_uInitSize, data());
+                m_uInitSize = std::exchange(Other.m_uInitSize, 0);
+            }
+            return *this;
+        }
+
+        constexpr ~CContainer() {
+            std::destroy_n(data(), m_uInitSize);
+        }
+
+        inline constexpr t_tType &operator[](size_t uIndex) { return data()[uIndex]; }
+
+        inline constexpr const t_tType &operator[](size_t uIndex) const { return data()[uIndex]; }
+
+        inline constexpr size_t size() const { return t_uSize; }
+
+        /**
+         * @return The amount of initialized elements.
+         */
+        inline constexpr size_t count() const { return m_uInitSize; }
+
+        /**
+         * The capacity is fixed, the elements past uNewSize are destroyed.
+         * @return The amount of elements in the container.
+         */
+        constexpr size_t resize(size_t uNewSize) {
+            CheckCapacity(uNewSize);
+            if (uNewSize < m_uInitSize) {
+                std::destroy(data() + uNewSize, data() + m_uInitSize);
+                m_uInitSize = uNewSize;
+            }
+            return m_uInitSize;
+        }
+
+        inline constexpr t_tType *data() { return m_Inline.Data(); }
+
+        inline constexpr const t_tType *data() const { return m_Inline.Data(); }
+
+        constexpr void insert(t_tType &&Item, size_t uIndex, size_t uShift) {
+            emplace(uIndex, uShift, std::move(Item));
+        }
+
+        constexpr void insert(const t_tType &Item, size_t uIndex, size_t uShift) {
+            emplace(uIndex, uShift, Item);
+        }
+
+        /**
+         * Constructs an element from Args in the slot uIndex.
+         * The arguments may reference elements of the container.
+         * @return The new element.
+         */
+        template<typename... t_tArgs>
+        constexpr t_tType &emplace(size_t uIndex, size_t uShift, t_tArgs &&... Args) {
+            CheckCapacity(uShift + 1);
+            if (uIndex < uShift) {
+                // Shifting moves the elements the arguments may reference
+                t_tType Item(std::forward<t_tArgs>(Args)...);
+                ShiftRight(data() + uIndex, uShift - uIndex);
+                try {
+                    std::construct_at(data() + uIndex, std::move(Item));
+                } catch (...) {
+                    ShiftLeft(data() + uIndex, uShift - uIndex);
+                    throw;
+                }
+            } else {
+                std::construct_at(data() + uIndex, std::forward<t_tArgs>(Args)...);
+            }
+            m_uInitSize += 1;
+            return data()[uIndex];
+        }
+
+        /**
+         * Inserts uCount elements read from First at uIndex, shifting the tail once.
+         */
+        template<std::forward_iterator t_tIterator>
+        constexpr void insert(t_tIterator First, size_t uCount, size_t uIndex, size_t uShift) {
+            CheckCapacity(uShift + uCount);
+            ShiftRight(data() + uIndex, uShift - uIndex, uCount);
+            size_t uDone = 0;
+            try {
+                for (; uDone < uCount; ++uDone, ++First) {
+                    std::construct_at(data() + uIndex + uDone, *First);
+                }
+            } catch (...) {
+                // Close the gap, the container is left as before the insertion
+                std::destroy_n(data() + uIndex, uDone);
+                ShiftLeft(data() + uIndex, uShift - uIndex, uCount);
+                throw;
+            }
+            m_uInitSize += uCount;
+        }
+
+        constexpr t_tType pop(size_t uIndex, size_t uShift) {
+            t_tType RtnVal{std::move(data()[uIndex])};
+            std::destroy_at(data() + uIndex);
+            ShiftLeft(data() + uIndex, uShift - uIndex - 1);
+            m_uInitSize -= 1;
+            return RtnVal;
+        }
+
+        /**
+         * Removes the elements in [uFirst, uLast), shifting the tail once.
+         */
+        constexpr void erase(size_t uFirst, size_t uLast, size_t uShift) {
+            std::destroy(data() + uFirst, data() + uLast);
+            ShiftLeft(data() + uFirst, uShift - uLast, uLast - uFirst);
+            m_uInitSize -= uLast - uFirst;
+        }
+
+        /**
+         * Removes the elements matching Predicate, compacting the kept ones in a single pass.
+         * @return The amount of removed elements.
+         */
+        template<typename t_tPredicate>
+        constexpr size_t erase_if(t_tPredicate &Predicate, size_t uShift) {
+            t_tType *pEnd = data() + uShift;
+            t_tType *pNewEnd = std::remove_if(data(), pEnd, Predicate);
+            auto uRemoved = static_cast<size_t>(pEnd - pNewEnd);
+
+            std::destroy(pNewEnd, pEnd);
+            m_uInitSize -= uRemoved;
+            return uRemoved;
+        }
+
+        /**
+         * Removes the element uIndex by moving the last element into its slot.
+         */
+        constexpr t_tType swap_remove(size_t uIndex, size_t uShift) {
+            t_tType RtnVal{std::move(data()[uIndex])};
+            if (uIndex != uShift - 1) {
+                data()[uIndex] = std::move(data()[uShift - 1]);
+            }
+            std::destroy_at(data() + uShift - 1);
+            m_uInitSize -= 1;
+            return RtnVal;
+        }
+
+        constexpr Iterator begin() { return Iterator(data()); }
+
+        constexpr Iterator end() { return Iterator(data() + m_uInitSize); }
+
+        constexpr ConstIterator begin() const { return ConstIterator(data()); }
+
+        constexpr ConstIterator end() const { return ConstIterator(data() + m_uInitSize); }
+
+        constexpr ConstIterator cbegin() const { return begin(); }
+
+        constexpr ConstIterator cend() const { return end(); }
+
+    protected:
+        size_t m_uInitSize = 0;
+        CInlineBuffer<t_tType, t_uSize> m_Inline;
+
+        static constexpr void CheckCapacity(size_t uRequired) {
+            Growth::CFixed::Grow(t_uSize, uRequired, sizeof(t_tType));
+        }
+    };
+
+    /**
+     * Random access iterator over the blocks of the segmented container.
+     * It holds the block table and the element's index, the block is the index's high bits.
+     * @tparam t_tType Element's data type, const qualified for the ConstIterator.
+     * @tparam t_uBlockShift Log2 of the elements per block.
+     */
+    template<typename t_tType, size_t t_uBlockShift>
+    class CSegmentIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<t_tType>;
+        using pointer = t_tType *;
+        using reference = t_tType &;
+
+        CSegmentIterator() : m_ppBlocks{nullptr}, m_uIndex{0} {}
+
+        CSegmentIterator(t_tType *const *ppBlocks, size_t uIndex) : m_ppBlocks{ppBlocks}, m_uIndex{uIndex} {}
+
+        reference operator*() const { return m_ppBlocks[m_uIndex >> t_uBlockShift][m_uIndex & s_uMask]; }
+
+        pointer operator->() const { return &**this; }
+
+        reference operator[](difference_type diff) const { return *(*this + diff); }
+
+        CSegmentIterator &operator++() {
+            ++m_uIndex;
+            return *this;
+        }
+
+        CSegmentIterator operator++(int) {
+            CSegmentIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        CSegmentIterator &operator--() {
+            --m_uIndex;
+            return *this;
+        }
+
+        CSegmentIterator operator--(int) {
+            CSegmentIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        CSegmentIterator &operator+=(difference_type diff) {
+            m_uIndex += static_cast<size_t>(diff);
+            return *this;
+        }
+
+        CSegmentIterator &operator-=(difference_type diff) {
+            m_uIndex -= static_cast<size_t>(diff);
+            return *this;
+        }
+
+        CSegmentIterator operator+(difference_type diff) const {
+            return CSegmentIterator(m_ppBlocks, m_uIndex + static_cast<size_t>(diff));
+        }
+
+        CSegmentIterator operator-(difference_type diff) const {
+            return CSegmentIterator(m_ppBlocks, m_uIndex - static_cast<size_t>(diff));
+        }
+
+        friend CSegmentIterator operator+(difference_type diff, const CSegmentIterator &it) { return it + diff; }
+
+        difference_type operator-(const CSegmentIterator &it) const {
+            return static_cast<difference_type>(m_uIndex - it.m_uIndex);
+        }
+
+        // The iterators of the same container share the block table, the index is enough
+        bool operator==(const CSegmentIterator &it) const { return m_uIndex == it.m_uIndex; }
+
+        std::strong_ordering operator<=>(const CSegmentIterator &it) const { return m_uIndex <=> it.m_uIndex; }
+
+    private:
+        static constexpr size_t s_uMask = (size_t{1} << t_uBlockShift) - 1;
+
+        t_tType *const *m_ppBlocks;
+        size_t m_uIndex;
+    };
+
+    /**
+     * Dynamic sized container implementation.
+     * It is allocated as fixed size blocks found through a block table, like a std::deque.
+     * <br/><br/>
+     * The growth allocates one block and never moves the existing elements, so pointers and references
+     * to them stay valid and the worst case insertion at the end is a block allocation plus, once in a while,
+     * the growth of the block table (a few pointers per block). Inserting or removing before the end shifts
+     * the following elements, like std::deque. The iterators are invalidated by the growth of the table.
+     * @tparam t_tType
+     * @tparam t_uBlockSize Size of the blocks in bytes.
+     * @tparam t_tAllocator Allocator of the blocks, rebound to allocate the block table.
+     */
+    template<typename t_tType, size_t t_uBlockSize, typename t_tAllocator>
+    class CContainer<t_tType, 0, false, Growth::CSegmented<t_uBlockSize>, t_tAllocator> {
+    protected:
+        using Policy = Growth::CSegmented<t_uBlockSize>;
+        using AllocatorTraits = std::allocator_traits<t_tAllocator>;
+        using TableAllocator = typename AllocatorTraits::template rebind_alloc<t_tType *>;
+        using Table = CContainer<t_tType *, 0, false, Growth::CDouble, TableAllocator>;
+        static_assert(std::is_same_v<typename AllocatorTraits::value_type, t_tType>);
+
+        static constexpr size_t s_uBlock = Policy::BlockCapacity(sizeof(t_tType));
+        static constexpr size_t s_uBlockShift = static_cast<size_t>(std::countr_zero(s_uBlock));
+
+    public:
+        using Iterator = CSegmentIterator<t_tType, s_uBlockShift>;
+        using ConstIterator = CSegmentIterator<const t_tType, s_uBlockShift>;
+
+    public:
+        CContainer() : CContainer(t_tAllocator{}) {}
+
+        explicit CContainer(const t_tAllocator &Allocator) : m_Blocks{TableAllocator{Allocator}}, m_Allocator{Allocator} {}
+
+        CContainer(CContainer &&Other) noexcept :
+                m_Blocks{std::move(Other.m_Blocks)}, m_uCount{std::exchange(Other.m_uCount, 0)},
+                m_Allocator{Other.m_Allocator} {}
+
+        /**
+         * Takes Other's blocks if the allocator propagates or both allocators are equal,
+         * otherwise the elements are moved one by one into blocks of this container's allocator.
+         */
+        CContainer &operator=(CContainer &&Other) noexcept(
+                AllocatorTraits::propagate_on_container_move_assignment::value ||
+                AllocatorTraits::is_always_equal::value) {
+            if (this != &Other) {
+                resize(0);
+                if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+                    m_Allocator = Other.m_Allocator;
+                }
+                if (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                    m_Allocator == Other.m_Allocator) {
+                    m_Blocks = std::move(Other.m_Blocks);
+                    m_uCount = std::exchange(Other.m_uCount, 0);
+                } else {
+                    for (auto &Item: Other) {
+                        emplace(m_uCount, m_uCount, std::move(Item));
+                    }
+                    Other.resize(0);
+                }
+            }
+            return *this;
+        }
+
+        ~CContainer() {
+            resize(0);
+        }
+
+        inline t_tAllocator get_allocator() const { return m_Allocator; }
+
+        inline t_tType &operator[](size_t uIndex) { return *Slot(uIndex); }
+
+        inline const t_tType &operator[](size_t uIndex) const { return *Slot(uIndex); }
+
+        /**
+         * @return The amount of elements the allocated blocks can hold.
+         */
+        inline size_t size() const { return m_Blocks.count() * s_uBlock; }
+
+        /**
+         * @return The amount of elements.
+         */
+        inline size_t count() const { return m_uCount; }
+
+        /**
+         * Destroys the elements past uNewSize and keeps exactly the blocks needed to hold uNewSize elements.
+         * @return The amount of elements in the container.
+         */
+        size_t resize(size_t uNewSize) {
+            for (; m_uCount > uNewSize; --m_uCount) {
+                AllocatorTraits::destroy(m_Allocator, Slot(m_uCount - 1));
+            }
+            SetCapacity(Policy::Grow(size(), uNewSize, sizeof(t_tType)));
+            return m_uCount;
+        }
+
+        void insert(t_tType &&Item, size_t uIndex, size_t uShift) {
+            emplace(uIndex, uShift, std::move(Item));
+        }
+
+        void insert(const t_tType &Item, size_t uIndex, size_t uShift) {
+            emplace(uIndex, uShift, Item);
+        }
+
+        /**
+         * Constructs an element from Args at uIndex.
+         * The arguments may reference elements of the container.
+         * @return The new element.
+         */
+        template<typename... t_tArgs>
+        t_tType &emplace(size_t uIndex, [[maybe_unused]] size_t uShift, t_tArgs &&... Args) {
+            if (uIndex >= m_uCount) {
+                // The existing elements are never moved, the arguments stay valid
+                Reserve(m_uCount + 1);
+                AllocatorTraits::construct(m_Allocator, Slot(m_uCount), std::forward<t_tArgs>(Args)...);
+                m_uCount += 1;
+                return *Slot(m_uCount - 1);
+            }
+
+            // Shifting moves the elements the arguments may reference
+            t_tType Item(std::forward<t_tArgs>(Args)...);
+            Reserve(m_uCount + 1);
+            AllocatorTraits::construct(m_Allocator, Slot(m_uCount), std::move(*Slot(m_uCount - 1)));
+            m_uCount += 1;
+            std::move_backward(begin() + uIndex, begin() + (m_uCount - 2), begin() + (m_uCount - 1));
+            *Slot(uIndex) = std::move(Item);
+            return *Slot(uIndex);
+        }
+
+        /**
+         * Inserts uCount elements read from First at uIndex.
+         * They are appended and rotated into place, the tail is moved once.
+         */
+        template<std::forward_iterator t_tIterator>
+        void insert(t_tIterator First, size_t uCount, size_t uIndex, [[maybe_unused]] size_t uShift) {
+            size_t uOldCount = m_uCount;
+            Reserve(m_uCount + uCount);
+            for (size_t i = 0; i < uCount; ++i, ++First) {
+                AllocatorTraits::construct(m_Allocator, Slot(m_uCount), *First);
+                m_uCount += 1;
+            }
+            if (uIndex < uOldCount) {
+                std::rotate(begin() + uIndex, begin() + uOldCount, begin() + m_uCount);
+            }
+        }
+
+        t_tType pop(size_t uIndex, [[maybe_unused]] size_t uShift) {
+            t_tType RtnVal{std::move(*Slot(uIndex))};
+            std::move(begin() + (uIndex + 1), begin() + m_uCount, begin() + uIndex);
+            DestroyTail(1);
+            return RtnVal;
+        }
+
+        /**
+         * Removes the elements in [uFirst, uLast), the tail is moved once.
+         */
+        void erase(size_t uFirst, size_t uLast, [[maybe_unused]] size_t uShift) {
+            std::move(begin() + uLast, begin() + m_uCount, begin() + uFirst);
+            DestroyTail(uLast - uFirst);
+        }
+
+        /**
+         * Removes the elements matching Predicate, compacting the kept ones in a single pass.
+         * @return The amount of removed elements.
+         */
+        template<typename t_tPredicate>
+        size_t erase_if(t_tPredicate &Predicate, [[maybe_unused]] size_t uShift) {
+            auto uRemoved = static_cast<size_t>(begin() + m_uCount - std::remove_if(begin(), begin() + m_uCount,
+                                                                                      Predicate));
+            DestroyTail(uRemoved);
+            return uRemoved;
+        }
+
+        /**
+         * Removes the element uIndex by moving the last element into its slot.
+         */
+        t_tType swap_remove(size_t uIndex, [[maybe_unused]] size_t uShift) {
+            t_tType RtnVal{std::move(*Slot(uIndex))};
+            if (uIndex != m_uCount - 1) {
+                *Slot(uIndex) = std::move(*Slot(m_uCount - 1));
+            }
+            DestroyTail(1);
+            return RtnVal;
+        }
+
+        Iterator begin() { return Iterator(m_Blocks.data(), 0); }
+
+        Iterator end() { return Iterator(m_Blocks.data(), m_uCount); }
+
+        ConstIterator begin() const { return ConstIterator(m_Blocks.data(), 0); }
+
+        ConstIterator end() const { return ConstIterator(m_Blocks.data(), m_uCount); }
+
+        ConstIterator cbegin() const { return begin(); }
+
+        ConstIterator cend() const { return end(); }
+
+    protected:
+        Table m_Blocks;
+        size_t m_uCount = 0;
+        [[no_unique_address]] t_tAllocator m_Allocator;
+
+        inline t_tType *Slot(size_t uIndex) const {
+            return m_Blocks[uIndex >> s_uBlockShift] + (uIndex & (s_uBlock - 1));
+        }
+
+        inline void Reserve(size_t uRequired) {
+            if (uRequired > size()) {
+                SetCapacity(Policy::Grow(size(), uRequired, sizeof(t_tType)));
+            }
+        }
+
+        /**
+         * Destroys the last uCount elements and frees the blocks the growth policy gives back.
+         */
+        void DestroyTail(size_t uCount) {
+            for (; uCount > 0; --uCount, --m_uCount) {
+                AllocatorTraits::destroy(m_Allocator, Slot(m_uCount - 1));
+            }
+            SetCapacity(Policy::Shrink(size(), m_uCount, sizeof(t_tType)));
+        }
+
+        /**
+         * Allocates or frees the last blocks to hold exactly uCapacity elements, a multiple of the block size.
+         */
+        void SetCapacity(size_t uCapacity) {
+            size_t uBlocks = uCapacity / s_uBlock;
+            while (m_Blocks.count() > uBlocks) {
+                AllocatorTraits::deallocate(m_Allocator, m_Blocks.pop(m_Blocks.count() - 1, m_Blocks.count()),
+                                            s_uBlock);
+            }
+            while (m_Blocks.count() < uBlocks) {
+                t_tType *pBlock = AllocatorTraits::allocate(m_Allocator, s_uBlock);
+                try {
+                    m_Blocks.insert(pBlock, m_Blocks.count(), m_Blocks.count());
+                } catch (...) {
+                    AllocatorTraits::deallocate(m_Allocator, pBlock, s_uBlock);
+                    throw;
+                }
+            }
+        }
+
+    private:
+        // === STATIC ASSERTS - to verify correct Iterator implementation! ===
+        static_assert(std::random_access_iterator<Iterator>);
+        static_assert(std::random_access_iterator<ConstIterator>);
+        static_assert(std::is_const<typename std::remove_reference<decltype(*ConstIterator())>::type>::value);
+    };
+
+    /**
+     * Node of the unrolled linked list.
+     * Each node holds a cache line sized block of elements, the first m_uCount are initialized.
+     * @tparam t_tType Element's data type.
+     */
+    template<typename t_tType>
+    struct CUnrolledNode {
+        static constexpr size_t s_uCapacity =
+                sizeof(t_tType) >= s_uCacheLineSize ? 1 : s_uCacheLineSize / sizeof(t_tType);
+
+        CUnrolledNode *m_pPrev = nullptr;
+        CUnrolledNode *m_pNext = nullptr;
+        size_t m_uCount = 0;
+        alignas(t_tType) std::byte m_arBuffer[sizeof(t_tType) * s_uCapacity];
+
+        inline t_tType *Data() { return std::launder(reinterpret_cast<t_tType *>(m_arBuffer)); }
+
+        inline const t_tType *Data() const { return std::launder(reinterpret_cast<const t_tType *>(m_arBuffer)); }
+    };
+
+    /**
+     * Bidirectional iterator over the unrolled linked list.
+     * The end iterator points one past the last element of the tail node.
+     * @tparam t_tType Element's data type, const qualified for the ConstIterator.
+     * @tparam t_tNode Node type, const qualified for the ConstIterator.
+     */
+    template<typename t_tType, typename t_tNode>
+    class CNodeIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<t_tType>;
+        using pointer = t_tType *;
+        using reference = t_tType &;
+
+        CNodeIterator() : m_pNode{nullptr}, m_uIndex{0} {}
+
+        CNodeIterator(t_tNode *pNode, size_t uIndex) : m_pNode{pNode}, m_uIndex{uIndex} {}
+
+        reference operator*() const { return m_pNode->Data()[m_uIndex]; }
+
+        pointer operator->() const { return &m_pNode->Data()[m_uIndex]; }
+
+        CNodeIterator &operator++() {
+            if (++m_uIndex == m_pNode->m_uCount && m_pNode->m_pNext != nullptr) {
+                m_pNode = m_pNode->m_pNext;
+                m_uIndex = 0;
+                Prefetch(m_pNode->m_pNext);
+            }
+            return *this;
+        }
+
+        CNodeIterator operator++(int) {
+            CNodeIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        CNodeIterator &operator--() {
+            if (m_uIndex == 0) {
+                m_pNode = m_pNode->m_pPrev;
+                m_uIndex = m_pNode->m_uCount;
+                Prefetch(m_pNode->m_pPrev);
+            }
+            --m_uIndex;
+            return *this;
+        }
+
+        CNodeIterator operator--(int) {
+            CNodeIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        bool operator==(const CNodeIterator &it) const { return m_pNode == it.m_pNode && m_uIndex == it.m_uIndex; }
+
+    private:
+        t_tNode *m_pNode;
+        size_t m_uIndex;
+    };
+
+    /**
+     * Dynamic sized container implementation.
+     * It is allocated as an unrolled linked list, every node holds a cache line sized block of elements,
+     * so inserting or removing in the middle only shifts the elements of one node.
+     * @tparam t_tType
+     * @tparam t_tGrowth Growth policy, emptied nodes are kept for later insertions until the policy shrinks.
+     * @tparam t_tAllocator Allocator of the elements, rebound to allocate the nodes.
+     */
+    template<typename t_tType, Growth::GrowthPolicy t_tGrowth, typename t_tAllocator>
+    class CContainer<t_tType, 0, true, t_tGrowth, t_tAllocator> {
+    protected:
+        using Node = CUnrolledNode<t_tType>;
+        using AllocatorTraits = std::allocator_traits<t_tAllocator>;
+        using NodeAllocator = typename AllocatorTraits::template rebind_alloc<Node>;
+        using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+        static_assert(std::is_same_v<typename AllocatorTraits::value_type, t_tType>);
+
+    public:
+        using Iterator = CNodeIterator<t_tType, Node>;
+        using ConstIterator = CNodeIterator<const t_tType, const Node>;
+
+    public:
+        CContainer() = default;
+
+        explicit CContainer(const t_tAllocator &Allocator) : m_Allocator{Allocator} {}
+
+        CContainer(const CContainer &) = delete;
+
+        CContainer &operator=(const CContainer &) = delete;
+
+        CContainer(CContainer &&Other) noexcept : m_Allocator{Other.m_Allocator} {
+            Swap(Other);
+        }
+
+        /**
+         * Takes Other's nodes if the allocator propagates or both allocators are equal,
+         * otherwise the elements are moved one by one into nodes of this container's allocator.
+         */
+        CContainer &operator=(CContainer &&Other) noexcept(
+                AllocatorTraits::propagate_on_container_move_assignment::value ||
+                AllocatorTraits::is_always_equal::value) {
+            if (this != &Other) {
+                Release();
+                if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+                    m_Allocator = Other.m_Allocator;
+                }
+                if (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                    m_Allocator == Other.m_Allocator) {
+                    Swap(Other);
+                } else {
+                    for (auto &Item: Other) {
+                        emplace(m_uCount, m_uCount, std::move(Item));
+                    }
+                    Other.Release();
+                }
+            }
+            return *this;
+        }
+
+        ~CContainer() {
+            Release();
+        }
+
+        inline t_tAllocator get_allocator() const { return m_Allocator; }
+
+        inline t_tType &operator[](size_t uIndex) {
+            auto [pNode, uOffset] = Locate(uIndex);
+            return pNode->Data()[uOffset];
+        }
+
+        inline const t_tType &operator[](size_t uIndex) const {
+            auto [pNode, uOffset] = Locate(uIndex);
+            return pNode->Data()[uOffset];
+        }
+
+        /**
+         * @return The amount of elements the allocated nodes can hold.
+         */
+        inline size_t size() const { return (m_uNodes + m_uSpareNodes) * Node::s_uCapacity; }
+
+        /**
+         * @return The amount of elements.
+         */
+        inline size_t count() const { return m_uCount; }
+
+        /**
+         * Destroys the elements past uNewSize and keeps only the nodes needed to hold uNewSize elements.
+         * @return The amount of elements in the container.
+         */
+        size_t resize(size_t uNewSize) {
+            while (m_uCount > uNewSize) {
+                size_t uDrop = std::min(m_uCount - uNewSize, m_pTail->m_uCount);
+                std::destroy_n(m_pTail->Data() + (m_pTail->m_uCount - uDrop), uDrop);
+                m_pTail->m_uCount -= uDrop;
+                m_uCount -= uDrop;
+                if (m_pTail->m_uCount == 0) {
+                    Unlink(m_pTail);
+                }
+            }
+
+            size_t uNodes = (uNewSize + Node::s_uCapacity - 1) / Node::s_uCapacity;
+            while (m_uNodes + m_uSpareNodes < uNodes) {
+                PushSpare(NewNode());
+            }
+            while (m_uNodes + m_uSpareNodes > uNodes && m_pSpare != nullptr) {
+                FreeNode(PopSpare());
+            }
+            return m_uCount;
+        }
+
+        void insert(t_tType &&Item, size_t uIndex, size_t uShift) {
+            emplace(uIndex, uShift, std::move(Item));
+        }
+
+        void insert(const t_tType &Item, size_t uIndex, size_t uShift) {
+            emplace(uIndex, uShift, Item);
+        }
+
+        /**
+         * Inserts uCount elements read from First at uIndex, locating the node once.
+         * The node is shifted once if the elements fit in it, otherwise it is split once at uIndex
+         * and the elements fill it and new nodes linked before the split off part.
+         */
+        template<std::forward_iterator t_tIterator>
+        void insert(t_tIterator First, size_t uCount, size_t uIndex, [[maybe_unused]] size_t uShift) {
+            if (uCount == 0) {
+                return;
+            }
+
+            Node *pNode = m_pTail;
+            size_t uOffset = 0;
+            if (pNode == nullptr) {
+                pNode = LinkAfter(nullptr);
+            } else if (uIndex >= m_uCount) {
+                uOffset = pNode->m_uCount;
+            } else {
+                std::tie(pNode, uOffset) = Locate(uIndex);
+            }
+            size_t uTail = pNode->m_uCount - uOffset;
+
+            if (pNode->m_uCount + uCount <= Node::s_uCapacity) {
+                t_tType *pData = pNode->Data();
+                ShiftRight(pData + uOffset, uTail, uCount);
+                size_t uDone = 0;
+                try {
+                    for (; uDone < uCount; ++uDone, ++First) {
+                        AllocatorTraits::construct(m_Allocator, pData + uOffset + uDone, *First);
+                    }
+                } catch (...) {
+                    pNode->m_uCount += uDone;
+                    m_uCount += uDone;
+                    CloseRoom(pNode, uOffset + uDone, uCount - uDone);
+                    throw;
+                }
+                pNode->m_uCount += uCount;
+                m_uCount += uCount;
+                return;
+            }
+
+            Node *pSplit = nullptr;
+            if (uTail > 0) {
+                pSplit = LinkAfter(pNode);
+                Relocate(pNode->Data() + uOffset, uTail, pSplit->Data());
+                pSplit->m_uCount = uTail;
+                pNode->m_uCount = uOffset;
+            }
+
+            // Every element is counted once constructed, a throwing one leaves the list valid
+            Node *pFill = pNode;
+            try {
+                for (size_t i = 0; i < uCount; ++i, ++First) {
+                    if (pFill->m_uCount == Node::s_uCapacity) {
+                        pFill = LinkAfter(pFill);
+                    }
+                    AllocatorTraits::construct(m_Allocator, pFill->Data() + pFill->m_uCount, *First);
+                    pFill->m_uCount += 1;
+                    m_uCount += 1;
+                }
+            } catch (...) {
+                if (pFill->m_uCount == 0) {
+                    Unlink(pFill);
+                }
+                throw;
+            }
+
+            // Merge the split off elements back if they fit after the inserted ones
+            if (pSplit != nullptr && pFill->m_uCount + pSplit->m_uCount <= Node::s_uCapacity) {
+                Relocate(pSplit->Data(), pSplit->m_uCount, pFill->Data() + pFill->m_uCount);
+                pFill->m_uCount += pSplit->m_uCount;
+                pSplit->m_uCount = 0;
+                Unlink(pSplit);
+            }
+        }
+
+        /**
+         * Constructs an element from Args at uIndex.
+         * The arguments may reference elements of the container.
+         * @return The new element.
+         */
+        template<typename... t_tArgs>
+        t_tType &emplace(size_t uIndex, [[maybe_unused]] size_t uShift, t_tArgs &&... Args) {
+            if (uIndex >= m_uCount) {
+                // Appending never moves the existing elements
+                Node *pNode = m_pTail;
+                if (pNode == nullptr || pNode->m_uCount == Node::s_uCapacity) {
+                    pNode = LinkAfter(m_pTail);
+                }
+                t_tType *pSlot = pNode->Data() + pNode->m_uCount;
+                try {
+                    AllocatorTraits::construct(m_Allocator, pSlot, std::forward<t_tArgs>(Args)...);
+                } catch (...) {
+                    // Only a node linked above is empty
+                    if (pNode->m_uCount == 0) {
+                        Unlink(pNode);
+                    }
+                    throw;
+                }
+                pNode->m_uCount += 1;
+                m_uCount += 1;
+                return *pSlot;
+            }
+
+            // Splitting or shifting the node moves the elements the arguments may reference
+            t_tType Item(std::forward<t_tArgs>(Args)...);
+            auto [pNode, uOffset] = MakeRoom(uIndex);
+            t_tType *pSlot = pNode->Data() + uOffset;
+            try {
+                AllocatorTraits::construct(m_Allocator, pSlot, std::move(Item));
+            } catch (...) {
+                CloseRoom(pNode, uOffset, 1);
+                throw;
+            }
+            pNode->m_uCount += 1;
+            m_uCount += 1;
+            return *pSlot;
+        }
+
+        t_tType pop(size_t uIndex, [[maybe_unused]] size_t uShift) {
+            auto [pNode, uOffset] = Locate(uIndex);
+            t_tType RtnVal{std::move(pNode->Data()[uOffset])};
+            EraseInNode(pNode, uOffset, 1);
+            return RtnVal;
+        }
+
+        /**
+         * Removes the elements in [uFirst, uLast), only the nodes holding them are touched.
+         */
+        void erase(size_t uFirst, size_t uLast, [[maybe_unused]] size_t uShift) {
+            if (uFirst == uLast) {
+                return;
+            }
+
+            auto [pNode, uOffset] = Locate(uFirst);
+            size_t uRemaining = uLast - uFirst;
+            while (uRemaining > 0) {
+                size_t uCount = std::min(uRemaining, pNode->m_uCount - uOffset);
+                uRemaining -= uCount;
+                std::tie(pNode, uOffset) = EraseInNode(pNode, uOffset, uCount);
+            }
+        }
+
+        /**
+         * Removes the elements matching Predicate, each node is compacted in a single pass.
+         * @return The amount of removed elements.
+         */
+        template<typename t_tPredicate>
+        size_t erase_if(t_tPredicate &Predicate, [[maybe_unused]] size_t uShift) {
+            size_t uRemoved = 0;
+            for (Node *pNode = m_pHead; pNode != nullptr;) {
+                Prefetch(pNode->m_pNext);
+                t_tType *pEnd = pNode->Data() + pNode->m_uCount;
+                t_tType *pNewEnd = std::remove_if(pNode->Data(), pEnd, Predicate);
+                auto uCount = static_cast<size_t>(pEnd - pNewEnd);
+
+                std::destroy(pNewEnd, pEnd);
+                pNode->m_uCount -= uCount;
+                m_uCount -= uCount;
+                uRemoved += uCount;
+
+                Node *pNext = pNode->m_pNext;
+                if (pNode->m_uCount == 0) {
+                    Unlink(pNode);
+                }
+                pNode = pNext;
+            }
+            return uRemoved;
+        }
+
+        /**
+         * Removes the element uIndex by moving the last element into its slot.
+         */
+        t_tType swap_remove(size_t uIndex, [[maybe_unused]] size_t uShift) {
+            auto [pNode, uOffset] = Locate(uIndex);
+            t_tType RtnVal{std::move(pNode->Data()[uOffset])};
+            t_tType *pLast = m_pTail->Data() + m_pTail->m_uCount - 1;
+            if (pNode->Data() + uOffset != pLast) {
+                pNode->Data()[uOffset] = std::move(*pLast);
+            }
+            std::destroy_at(pLast);
+            m_pTail->m_uCount -= 1;
+            m_uCount -= 1;
+            if (m_pTail->m_uCount == 0) {
+                Unlink(m_pTail);
+            }
+            return RtnVal;
+        }
+
+        Iterator begin() { return Iterator(m_pHead, 0); }
+
+        Iterator end() { return m_pTail == nullptr ? Iterator() : Iterator(m_pTail, m_pTail->m_uCount); }
+
+        ConstIterator begin() const { return ConstIterator(m_pHead, 0); }
+
+        ConstIterator end() const {
+            return m_pTail == nullptr ? ConstIterator() : ConstIterator(m_pTail, m_pTail->m_uCount);
+        }
+
+        ConstIterator cbegin() const { return begin(); }
+
+        ConstIterator cend() const { return end(); }
+
+    protected:
+        Node *m_pHead = nullptr;
+        Node *m_pTail = nullptr;
+        Node *m_pSpare = nullptr;
+        size_t m_uCount = 0;
+        size_t m_uNodes = 0;
+        size_t m_uSpareNodes = 0;
+        [[no_unique_address]] t_tAllocator m_Allocator;
+
+        /**
+         * Opens an uninitialized slot at uIndex, splitting the node if it is full.
+         * The slot is not counted yet, the caller counts it once the element is constructed
+         * or closes it with CloseRoom().
+         * @return The node holding the slot and the slot's offset inside it.
+         */
+        std::pair<Node *, size_t> MakeRoom(size_t uIndex) {
+            Node *pNode = m_pTail;
+            size_t uOffset = 0;
+            if (pNode == nullptr) {
+                pNode = LinkAfter(nullptr);
+            } else if (uIndex >= m_uCount) {
+                uOffset = pNode->m_uCount;
+            } else {
+                std::tie(pNode, uOffset) = Locate(uIndex);
+            }
+
+            if (pNode->m_uCount == Node::s_uCapacity) {
+                Node *pNew = LinkAfter(pNode);
+                if (uOffset == Node::s_uCapacity) {
+                    // Appending after a full node, start filling the new one
+                    pNode = pNew;
+                    uOffset = 0;
+                } else {
+                    // Split the node in half
+                    size_t uKeep = Node::s_uCapacity / 2;
+                    size_t uMove = Node::s_uCapacity - uKeep;
+                    Relocate(pNode->Data() + uKeep, uMove, pNew->Data());
+                    pNode->m_uCount = uKeep;
+                    pNew->m_uCount = uMove;
+                    if (uOffset > uKeep) {
+                        pNode = pNew;
+                        uOffset -= uKeep;
+                    }
+                }
+            }
+
+            ShiftRight(pNode->Data() + uOffset, pNode->m_uCount - uOffset);
+            return {pNode, uOffset};
+        }
+
+        /**
+         * Closes uCount uninitialized slots opened at uOffset of pNode, unlinking the node if it is empty.
+         */
+        void CloseRoom(Node *pNode, size_t uOffset, size_t uCount) {
+            ShiftLeft(pNode->Data() + uOffset, pNode->m_uCount - uOffset, uCount);
+            if (pNode->m_uCount == 0) {
+                Unlink(pNode);
+            }
+        }
+
+        /**
+         * Destroys uCount elements of pNode starting at uOffset and closes the gap.
+         * The node is unlinked if it becomes empty, or merged with its successor if it is almost empty.
+         * @return The position of the element following the erased ones.
+         */
+        std::pair<Node *, size_t> EraseInNode(Node *pNode, size_t uOffset, size_t uCount) {
+            t_tType *pData = pNode->Data();
+            std::destroy_n(pData + uOffset, uCount);
+            ShiftLeft(pData + uOffset, pNode->m_uCount - uOffset - uCount, uCount);
+            pNode->m_uCount -= uCount;
+            m_uCount -= uCount;
+
+            Node *pNext = pNode->m_pNext;
+            if (pNode->m_uCount == 0) {
+                Unlink(pNode);
+                return {pNext, 0};
+            }
+
+            if (pNode->m_uCount < Node::s_uCapacity / 4 && pNext != nullptr &&
+                pNode->m_uCount + pNext->m_uCount <= Node::s_uCapacity) {
+                // Merge the almost empty node with its successor, keeps the list from degenerating
+                Relocate(pNext->Data(), pNext->m_uCount, pData + pNode->m_uCount);
+                pNode->m_uCount += pNext->m_uCount;
+                pNext->m_uCount = 0;
+                Unlink(pNext);
+            }
+            if (uOffset == pNode->m_uCount) {
+                return {pNode->m_pNext, 0};
+            }
+            return {pNode, uOffset};
+        }
+
+        /**
+         * Finds the node holding the element uIndex, walks from the closest end of the list.
+         * @return The node and the element's offset inside it.
+         */
+        std::pair<Node *, size_t> Locate(size_t uIndex) const {
+            if (uIndex < m_uCount / 2) {
+                Node *pNode = m_pHead;
+                while (uIndex >= pNode->m_uCount) {
+                    uIndex -= pNode->m_uCount;
+                    pNode = pNode->m_pNext;
+                    Prefetch(pNode->m_pNext);
+                }
+                return {pNode, uIndex};
+            }
+
+            Node *pNode = m_pTail;
+            size_t uRemaining = m_uCount - uIndex;
+            while (uRemaining > pNode->m_uCount) {
+                uRemaining -= pNode->m_uCount;
+                pNode = pNode->m_pPrev;
+                Prefetch(pNode->m_pPrev);
+            }
+            return {pNode, pNode->m_uCount - uRemaining};
+        }
+
+        /**
+         * Links a node after pPrev, if pPrev is nullptr the node becomes the head.
+         */
+        Node *LinkAfter(Node *pPrev) {
+            Node *pNode = m_pSpare != nullptr ? PopSpare() : NewNode();
+            pNode->m_pPrev = pPrev;
+            pNode->m_pNext = pPrev != nullptr ? pPrev->m_pNext : m_pHead;
+            (pNode->m_pNext != nullptr ? pNode->m_pNext->m_pPrev : m_pTail) = pNode;
+            (pPrev != nullptr ? pPrev->m_pNext : m_pHead) = pNode;
+            m_uNodes += 1;
+            return pNode;
+        }
+
+        /**
+         * Unlinks an empty node, the node is kept as spare unless the growth policy shrinks the capacity.
+         */
+        void Unlink(Node *pNode) {
+            (pNode->m_pPrev != nullptr ? pNode->m_pPrev->m_pNext : m_pHead) = pNode->m_pNext;
+            (pNode->m_pNext != nullptr ? pNode->m_pNext->m_pPrev : m_pTail) = pNode->m_pPrev;
+            m_uNodes -= 1;
+            PushSpare(pNode);
+
+            size_t uNodes = m_uNodes + m_uSpareNodes;
+            size_t uUsedNodes = (m_uCount + Node::s_uCapacity - 1) / Node::s_uCapacity;
+            size_t uTarget = std::max(t_tGrowth::Shrink(uNodes, uUsedNodes, sizeof(Node)), m_uNodes);
+            while (uNodes > uTarget && m_pSpare != nullptr) {
+                FreeNode(PopSpare());
+                uNodes -= 1;
+            }
+        }
+
+        Node *NewNode() {
+            NodeAllocator Allocator{m_Allocator};
+            return std::construct_at(NodeAllocatorTraits::allocate(Allocator, 1));
+        }
+
+        void FreeNode(Node *pNode) {
+            NodeAllocator Allocator{m_Allocator};
+            std::destroy_at(pNode);
+            NodeAllocatorTraits::deallocate(Allocator, pNode, 1);
+        }
+
+        void PushSpare(Node *pNode) {
+            pNode->m_pPrev = nullptr;
+            pNode->m_pNext = m_pSpare;
+            m_pSpare = pNode;
+            m_uSpareNodes += 1;
+        }
+
+        Node *PopSpare() {
+            Node *pNode = m_pSpare;
+            m_pSpare = pNode->m_pNext;
+            m_uSpareNodes -= 1;
+            pNode->m_pNext = nullptr;
+            pNode->m_uCount = 0;
+            return pNode;
+        }
+
+        void Release() {
+            while (m_pHead != nullptr) {
+                Node *pNext = m_pHead->m_pNext;
+                std::destroy_n(m_pHead->Data(), m_pHead->m_uCount);
+                FreeNode(m_pHead);
+                m_pHead = pNext;
+            }
+            while (m_pSpare != nullptr) {
+                FreeNode(PopSpare());
+            }
+            m_pTail = nullptr;
+            m_uCount = 0;
+            m_uNodes = 0;
+        }
+
+        void Swap(CContainer &Other) noexcept {
+            std::swap(m_pHead, Other.m_pHead);
+            std::swap(m_pTail, Other.m_pTail);
+            std::swap(m_pSpare, Other.m_pSpare);
+            std::swap(m_uCount, Other.m_uCount);
+            std::swap(m_uNodes, Other.m_uNodes);
+            std::swap(m_uSpareNodes, Other.m_uSpareNodes);
+        }
+
+    private:
+        // === STATIC ASSERTS - to verify correct Iterator implementation! ===
+        static_assert(std::bidirectional_iterator<Iterator>);
+        static_assert(std::bidirectional_iterator<ConstIterator>);
+        static_assert(std::is_const<typename std::remove_reference<decltype(*ConstIterator())>::type>::value);
     };
 }
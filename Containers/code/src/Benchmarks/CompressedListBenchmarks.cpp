@@ -0,0 +1,104 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <Containers/CompressedList.hpp>
+#include <Containers/List.hpp>
+#include <nanobench/nanobench.h>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <string>
+#include <typeinfo>
+
+TEST_SUITE("") {
+    TEST_CASE_TEMPLATE("Compressed list benchmark", t_tTestType, uint32_t, uint64_t) {
+        /**
+         * Sorted ID lists of 10^7 values with small, larger and mostly small gaps.
+         * The compression ratio is in the titles, the decode throughput is compared with reading a CList.
+         */
+        constexpr size_t uNumItems = 10'000'000;
+        std::vector<std::pair<std::string, eho::Simd::ELevel>> vecLevels{{"Scalar", eho::Simd::ELevel::Scalar}};
+        for (auto [strName, eLevel]: {std::pair{"SSE", eho::Simd::ELevel::SSE},
+                                      std::pair{"AVX2", eho::Simd::ELevel::AVX2},
+                                      std::pair{"AVX-512", eho::Simd::ELevel::AVX512}}) {
+            if (eLevel <= eho::Simd::level()) {
+                vecLevels.emplace_back(strName, eLevel);
+            }
+        }
+
+        // The gaps average under 400, so the uint32_t values do not overflow
+        for (auto [strGaps, uMaxGap, uOutliers]: {std::tuple{"gaps < 16", 16u, 0u}, std::tuple{"gaps < 256", 256u, 0u},
+                                                  std::tuple{"gaps < 8, 1% < 10^4", 8u, 100u}}) {
+            std::mt19937_64 Generator{42};
+            eho::CList<t_tTestType> lst{};
+            eho::CCompressedList<t_tTestType> lstCompressed{};
+            lst.resize(uNumItems);
+            t_tTestType Value = 0;
+            for (size_t i = 0; i < uNumItems; ++i) {
+                bool bOutlier = uOutliers != 0 && Generator() % uOutliers == 0;
+                Value += static_cast<t_tTestType>(bOutlier ? Generator() % 10'000 : Generator() % uMaxGap);
+                lst.insert(Value);
+                lstCompressed.push_back(Value);
+            }
+
+            std::array<char, 32> arRatio{};
+            std::snprintf(arRatio.data(), arRatio.size(), "%.2f",
+                          static_cast<double>(uNumItems * sizeof(t_tTestType)) /
+                          static_cast<double>(lstCompressed.compressed_size()));
+            std::string strTitle = std::string{"10^7 "} + typeid(t_tTestType).name() + ", " + strGaps +
+                                   ", compression ratio " + arRatio.data();
+
+            ankerl::nanobench::Bench BDecode{};
+            BDecode.relative(true).title("Decode " + strTitle).unit("item").batch(uNumItems).minEpochIterations(3);
+            BDecode.run("eho::CList: sum", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(std::accumulate(lst.begin(), lst.end(), t_tTestType{}));
+            });
+            for (const auto &[strName, eLevel]: vecLevels) {
+                BDecode.run("eho::CCompressedList: decode + sum, " + strName, [&]() {
+                    std::array<t_tTestType, 128> arBlock{};
+                    t_tTestType Sum{};
+                    for (size_t uBlock = 0; uBlock < lstCompressed.blocks(); ++uBlock) {
+                        size_t uCount = lstCompressed.decode(uBlock, arBlock.data(), eLevel);
+                        Sum = std::accumulate(arBlock.begin(), arBlock.begin() + static_cast<std::ptrdiff_t>(uCount),
+                                              Sum);
+                    }
+                    ankerl::nanobench::doNotOptimizeAway(Sum);
+                });
+            }
+            BDecode.run("eho::CCompressedList: iterator sum", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(
+                        std::accumulate(lstCompressed.begin(), lstCompressed.end(), t_tTestType{}));
+            });
+
+            // Random searches, the compressed list decodes one block per search
+            constexpr size_t uNumSearches = 100'000;
+            std::vector<t_tTestType> vecSearches(uNumSearches);
+            std::ranges::generate(vecSearches, [&]() { return static_cast<t_tTestType>(Generator() % (Value + 1)); });
+            ankerl::nanobench::Bench BSearch{};
+            BSearch.relative(true).title("lower_bound in " + strTitle).unit("search").batch(uNumSearches)
+                    .minEpochIterations(3);
+            BSearch.run("eho::CList: std::lower_bound", [&]() {
+                t_tTestType Sum{};
+                for (t_tTestType Search: vecSearches) {
+                    auto it = std::ranges::lower_bound(lst, Search);
+                    Sum += it == lst.end() ? 0 : *it;
+                }
+                ankerl::nanobench::doNotOptimizeAway(Sum);
+            });
+            BSearch.run("eho::CCompressedList: lower_bound", [&]() {
+                t_tTestType Sum{};
+                for (t_tTestType Search: vecSearches) {
+                    auto it = lstCompressed.lower_bound(Search);
+                    Sum += it == lstCompressed.end() ? 0 : *it;
+                }
+                ankerl::nanobench::doNotOptimizeAway(Sum);
+            });
+        }
+    }
+}
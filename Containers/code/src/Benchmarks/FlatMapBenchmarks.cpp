@@ -0,0 +1,106 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <Containers/FlatMap.hpp>
+#include <nanobench/nanobench.h>
+#include <doctest/doctest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+TEST_SUITE("") {
+    TEST_CASE("Flat map lookup benchmark") {
+        /**
+         * Random lookups of present keys, from maps fitting in the L1 cache to maps far larger than the L3.
+         * The node based maps are skipped at 10^8 keys, they need several GB.
+         */
+        constexpr size_t uNumLookups = 100'000;
+        for (size_t uNumItems: {1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000}) {
+            std::mt19937_64 Generator{42};
+            std::vector<std::pair<uint64_t, uint64_t>> vecItems(uNumItems);
+            for (size_t i = 0; i < uNumItems; ++i) {
+                vecItems[i] = {Generator(), i};
+            }
+            std::vector<uint64_t> vecLookups(uNumLookups);
+            for (auto &uKey: vecLookups) {
+                uKey = vecItems[Generator() % uNumItems].first;
+            }
+
+            ankerl::nanobench::Bench B{};
+            B.relative(true).title("Lookups in " + std::to_string(uNumItems) + " keys").unit("lookup")
+                    .batch(uNumLookups).minEpochIterations(5);
+            if (uNumItems >= 10'000'000) {
+                B.epochs(3);
+            }
+
+            /**
+             * Sums the values found for vecLookups.
+             */
+            auto Lookups = [&](const std::string &strName, const auto &Map, auto Find) {
+                B.run(strName, [&]() {
+                    uint64_t uSum = 0;
+                    for (uint64_t uKey: vecLookups) {
+                        uSum += Find(Map, uKey);
+                    }
+                    ankerl::nanobench::doNotOptimizeAway(uSum);
+                });
+            };
+
+            if (uNumItems < 100'000'000) {
+                std::map<uint64_t, uint64_t> Map(vecItems.begin(), vecItems.end());
+                Lookups("std::map", Map, [](const auto &Map, uint64_t uKey) { return Map.find(uKey)->second; });
+            }
+            if (uNumItems < 100'000'000) {
+                std::unordered_map<uint64_t, uint64_t> Map(vecItems.begin(), vecItems.end());
+                Lookups("std::unordered_map", Map, [](const auto &Map, uint64_t uKey) {
+                    return Map.find(uKey)->second;
+                });
+            }
+            {
+                eho::CFlatMap<uint64_t, uint64_t> Map{vecItems};
+                Lookups("eho::CFlatMap: Sorted", Map, [](const auto &Map, uint64_t uKey) { return *Map.find(uKey); });
+            }
+            {
+                eho::CFlatMap<uint64_t, uint64_t, eho::Layout::CEytzinger> Map{vecItems};
+                Lookups("eho::CFlatMap: Eytzinger", Map, [](const auto &Map, uint64_t uKey) {
+                    return *Map.find(uKey);
+                });
+            }
+        }
+    }
+
+    TEST_CASE("Flat map build benchmark") {
+        /**
+         * Construction from unsorted pairs, sorted once, against inserting them one by one.
+         */
+        constexpr size_t uNumItems = 1'000'000;
+        std::mt19937_64 Generator{42};
+        std::vector<std::pair<uint64_t, uint64_t>> vecItems(uNumItems);
+        for (size_t i = 0; i < uNumItems; ++i) {
+            vecItems[i] = {Generator(), i};
+        }
+
+        ankerl::nanobench::Bench B{};
+        B.relative(true).title("Build from 10^6 unsorted keys").unit("item").batch(uNumItems).epochs(3);
+        B.run("std::map", [&]() {
+            std::map<uint64_t, uint64_t> Map(vecItems.begin(), vecItems.end());
+            ankerl::nanobench::doNotOptimizeAway(Map.size());
+        });
+        B.run("std::unordered_map", [&]() {
+            std::unordered_map<uint64_t, uint64_t> Map(vecItems.begin(), vecItems.end());
+            ankerl::nanobench::doNotOptimizeAway(Map.size());
+        });
+        B.run("eho::CFlatMap: Sorted", [&]() {
+            eho::CFlatMap<uint64_t, uint64_t> Map{vecItems};
+            ankerl::nanobench::doNotOptimizeAway(Map.size());
+        });
+        B.run("eho::CFlatMap: Eytzinger", [&]() {
+            eho::CFlatMap<uint64_t, uint64_t, eho::Layout::CEytzinger> Map{vecItems};
+            ankerl::nanobench::doNotOptimizeAway(Map.size());
+        });
+    }
+}
@@ -7,8 +7,18 @@
 #define ANKERL_NANOBENCH_IMPLEMENT
 
 #include <Containers/List.hpp>
+#include <Containers/ListConcurrent.hpp>
+#include <Containers/ListCow.hpp>
+#include <Containers/ListGap.hpp>
+#include <Containers/ListRing.hpp>
 #include <nanobench/nanobench.h>
 #include <doctest/doctest.h>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
 
 
 TEST_SUITE("") {
@@ -33,7 +43,7 @@ TEST_SUITE("") {
          */
 
         std::vector<t_tTestType> lstVector;
-        eho::CList<t_tTestType, true> myLst;
+        eho::CList<t_tTestType, eho::Growth::CAmortized> myLst;
 
         SUBCASE("Populate") {
             CBenchmark BPopulate{std::string("Populate: ") + typeid(t_tTestType).name()};
@@ -60,6 +70,54 @@ TEST_SUITE("") {
             // Random position insertion
         }
 
+        SUBCASE("Batch populate") {
+            CBenchmark BBatch{std::string("Batch populate: ") + typeid(t_tTestType).name()};
+            std::vector<t_tTestType> vecBatch(10000, static_cast<t_tTestType>(1234));
+
+            BBatch().run("std::vector: insert range", [&]() {
+                std::vector<t_tTestType> vec{};
+                vec.insert(vec.end(), vecBatch.begin(), vecBatch.end());
+                ankerl::nanobench::doNotOptimizeAway(vec);
+            });
+            BBatch().run("eho::CList: single insertions", [&]() {
+                eho::CList<t_tTestType> lst{};
+                for (const auto &Item: vecBatch) {
+                    lst.insert(Item);
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+            BBatch().run("eho::CList: append_range", [&]() {
+                eho::CList<t_tTestType> lst{};
+                lst.append_range(vecBatch);
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+            BBatch().run("eho::CList: front range insertion", [&]() {
+                eho::CList<t_tTestType> lst{};
+                for (size_t i = 0; i < 10; ++i) {
+                    lst.insert(0, vecBatch.begin(), vecBatch.begin() + 1000);
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+        }
+
+        SUBCASE("Front insertion") {
+            CBenchmark BFront{std::string("Front insertion: ") + typeid(t_tTestType).name()};
+            BFront().run("std::vector: Front insertion", [&]() {
+                std::vector<t_tTestType> vec{};
+                for (size_t i = 0; i < 10000; ++i) {
+                    vec.insert(vec.begin(), 1234);
+                }
+                ankerl::nanobench::doNotOptimizeAway(vec);
+            });
+            BFront().run("eho::CList: Front insertion", [&]() {
+                eho::CList<t_tTestType, eho::Growth::CAmortized> lst{};
+                for (size_t i = 0; i < 10000; ++i) {
+                    lst.insert(0, 1234);
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+        }
+
         SUBCASE("Iterate") {
             CBenchmark BIterate{std::string("Iterate: ") + typeid(t_tTestType).name()};
             std::random_device RandomDevice;
@@ -153,6 +211,668 @@ TEST_SUITE("") {
             });
         }
 
+        SUBCASE("Filter") {
+            /**
+             * Drops ~30% of the elements, std::erase_if against CList::erase_if and a pop() loop.
+             */
+            CBenchmark BFilter{std::string("Filter 30%: ") + typeid(t_tTestType).name()};
+            std::random_device RandomDevice;
+            std::mt19937 Generator{RandomDevice()};
+            auto Predicate = [](const t_tTestType &Item) { return static_cast<uint64_t>(Item) % 10 < 3; };
+
+            std::vector<t_tTestType> vecSource{};
+            for (size_t i = 0; i < 1000000; ++i) {
+                vecSource.push_back(static_cast<t_tTestType>(Generator() % 1000000));
+            }
+
+            BFilter().run("std::vector: std::erase_if 1M", [&]() {
+                std::vector<t_tTestType> vec{vecSource};
+                ankerl::nanobench::doNotOptimizeAway(std::erase_if(vec, Predicate));
+            });
+            BFilter().run("eho::CList: erase_if 1M", [&]() {
+                eho::CList<t_tTestType> lst{};
+                lst.append_range(vecSource);
+                ankerl::nanobench::doNotOptimizeAway(lst.erase_if(Predicate));
+            });
+            BFilter().run("eho::CList: pop loop 10k", [&]() {
+                eho::CList<t_tTestType> lst{};
+                lst.insert(0, vecSource.begin(), vecSource.begin() + 10000);
+                for (size_t i = lst.size(); i-- > 0;) {
+                    if (Predicate(lst[i])) {
+                        lst.pop(i);
+                    }
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+            BFilter().run("eho::CList: erase_if 10k", [&]() {
+                eho::CList<t_tTestType> lst{};
+                lst.insert(0, vecSource.begin(), vecSource.begin() + 10000);
+                ankerl::nanobench::doNotOptimizeAway(lst.erase_if(Predicate));
+            });
+        }
+
         // deletion
     }
+
+    TEST_CASE("String insertion benchmark") {
+        /**
+         * Strings longer than the small string buffer, every copy allocates.
+         */
+        constexpr size_t uNumItems = 10000;
+        const char *szValue = "127893498ajkshdjkvxcjkb__89iow37e";
+        CBenchmark BString{"Insert std::string"};
+
+        BString().run("std::vector: emplace_back", [&]() {
+            std::vector<std::string> vec{};
+            vec.reserve(uNumItems);
+            for (size_t i = 0; i < uNumItems; ++i) {
+                vec.emplace_back(szValue);
+            }
+            ankerl::nanobench::doNotOptimizeAway(vec);
+        });
+        BString().run("eho::CList: insert(const std::string &)", [&]() {
+            eho::CList<std::string> lst{};
+            lst.resize(uNumItems);
+            for (size_t i = 0; i < uNumItems; ++i) {
+                std::string strValue{szValue};
+                lst.insert(strValue);
+            }
+            ankerl::nanobench::doNotOptimizeAway(lst);
+        });
+        BString().run("eho::CList: insert(std::string &&)", [&]() {
+            eho::CList<std::string> lst{};
+            lst.resize(uNumItems);
+            for (size_t i = 0; i < uNumItems; ++i) {
+                lst.insert(std::string{szValue});
+            }
+            ankerl::nanobench::doNotOptimizeAway(lst);
+        });
+        BString().run("eho::CList: emplace_back", [&]() {
+            eho::CList<std::string> lst{};
+            lst.resize(uNumItems);
+            for (size_t i = 0; i < uNumItems; ++i) {
+                lst.emplace_back(szValue);
+            }
+            ankerl::nanobench::doNotOptimizeAway(lst);
+        });
+    }
+
+    /**
+     * Fills a list, oscillates around its size with insert/pop and then drains it.
+     * @return The amount of reallocations, counted as capacity changes.
+     */
+    template<typename t_tPolicy>
+    size_t GrowthWorkload(size_t uNumItems) {
+        eho::CList<uint32_t, t_tPolicy> lst{};
+        size_t uReallocations = 0;
+        size_t uCapacity = lst.capacity();
+        auto Track = [&]() {
+            uReallocations += uCapacity != lst.capacity() ? 1 : 0;
+            uCapacity = lst.capacity();
+        };
+
+        for (size_t i = 0; i < uNumItems; ++i) {
+            lst.insert(static_cast<uint32_t>(i));
+            Track();
+        }
+        for (size_t i = 0; i < uNumItems; ++i) {
+            lst.pop();
+            Track();
+            lst.insert(static_cast<uint32_t>(i));
+            Track();
+        }
+        while (!lst.empty()) {
+            lst.pop();
+            Track();
+        }
+        return uReallocations;
+    }
+
+    template<typename t_tPolicy>
+    void BenchmarkGrowthPolicy(CBenchmark &Bench, const std::string &strPolicy, size_t uNumItems) {
+        size_t uReallocations = GrowthWorkload<t_tPolicy>(uNumItems);
+        Bench().run(strPolicy + " (" + std::to_string(uReallocations) + " reallocations)", [&]() {
+            ankerl::nanobench::doNotOptimizeAway(GrowthWorkload<t_tPolicy>(uNumItems));
+        });
+    }
+
+    TEST_CASE("Growth policy benchmark") {
+        /**
+         * Fill, insert/pop oscillation and drain of a CList<uint32_t> with each growth policy.
+         */
+        constexpr size_t uNumItems = 10000;
+        CBenchmark BGrowth{"Growth policies: fill + oscillate + drain"};
+        BenchmarkGrowthPolicy<eho::Growth::CExact<>>(BGrowth, "Growth::CExact", uNumItems);
+        BenchmarkGrowthPolicy<eho::Growth::CExact<0>>(BGrowth, "Growth::CExact without shrink", uNumItems);
+        BenchmarkGrowthPolicy<eho::Growth::CAmortized>(BGrowth, "Growth::CAmortized", uNumItems);
+        BenchmarkGrowthPolicy<eho::Growth::CDouble>(BGrowth, "Growth::CDouble", uNumItems);
+        BenchmarkGrowthPolicy<eho::Growth::CPowerOfTwo<>>(BGrowth, "Growth::CPowerOfTwo", uNumItems);
+        BenchmarkGrowthPolicy<eho::Growth::CPageGranular<eho::Growth::CAmortized>>(
+                BGrowth, "Growth::CPageGranular", uNumItems);
+    }
+
+    TEST_CASE_TEMPLATE("Linked list benchmark", t_tTestType, uint32_t, int64_t, float, double) {
+        /**
+         * Compares the unrolled linked list with the contiguous list and std::list
+         * on middle of the sequence insertions and removals.
+         */
+        constexpr size_t uNumItems = 10000;
+        std::random_device RandomDevice;
+        std::mt19937 Generator{RandomDevice()};
+
+        std::vector<size_t> vecPositions{};
+        for (size_t i = 0; i < uNumItems; ++i) {
+            vecPositions.push_back(Generator() % (i + 1));
+        }
+
+        SUBCASE("Middle insertion") {
+            CBenchmark BInsert{std::string("Middle insertion: ") + typeid(t_tTestType).name()};
+            BInsert().run("std::list: insert", [&]() {
+                std::list<t_tTestType> lst{};
+                for (auto uIndex: vecPositions) {
+                    lst.insert(std::next(lst.begin(), static_cast<std::ptrdiff_t>(uIndex)), 1234);
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+            BInsert().run("eho::CList: insert", [&]() {
+                eho::CList<t_tTestType, eho::Growth::CAmortized> lst{};
+                for (auto uIndex: vecPositions) {
+                    lst.insert(uIndex, 1234);
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+            BInsert().run("eho::CListLinked: insert", [&]() {
+                eho::CListLinked<t_tTestType> lst{};
+                for (auto uIndex: vecPositions) {
+                    lst.insert(uIndex, 1234);
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+        }
+
+        SUBCASE("Middle removal") {
+            CBenchmark BRemove{std::string("Middle removal: ") + typeid(t_tTestType).name()};
+            BRemove().run("std::list: pop", [&]() {
+                std::list<t_tTestType> lst(uNumItems, 1234);
+                for (size_t i = uNumItems; i-- > 0;) {
+                    lst.erase(std::next(lst.begin(), static_cast<std::ptrdiff_t>(vecPositions[i])));
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+            BRemove().run("eho::CList: pop", [&]() {
+                eho::CList<t_tTestType, eho::Growth::CAmortized> lst{};
+                for (size_t i = 0; i < uNumItems; ++i) {
+                    lst.insert(1234);
+                }
+                for (size_t i = uNumItems; i-- > 0;) {
+                    lst.pop(vecPositions[i]);
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+            BRemove().run("eho::CListLinked: pop", [&]() {
+                eho::CListLinked<t_tTestType> lst{};
+                for (size_t i = 0; i < uNumItems; ++i) {
+                    lst.insert(1234);
+                }
+                for (size_t i = uNumItems; i-- > 0;) {
+                    lst.pop(vecPositions[i]);
+                }
+                ankerl::nanobench::doNotOptimizeAway(lst);
+            });
+        }
+
+        SUBCASE("Iterate") {
+            CBenchmark BIterate{std::string("Linked iterate: ") + typeid(t_tTestType).name()};
+            std::list<t_tTestType> lstStd{};
+            eho::CList<t_tTestType, eho::Growth::CAmortized> lstContiguous{};
+            eho::CListLinked<t_tTestType> lstLinked{};
+            for (auto uIndex: vecPositions) {
+                auto Value = static_cast<t_tTestType>(Generator());
+                lstStd.insert(std::next(lstStd.begin(), static_cast<std::ptrdiff_t>(uIndex)), Value);
+                lstContiguous.insert(uIndex, Value);
+                lstLinked.insert(uIndex, Value);
+            }
+
+            BIterate().minEpochIterations(1000).run("std::list: accumulate", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(std::accumulate(lstStd.begin(), lstStd.end(), t_tTestType{}));
+            });
+            BIterate().minEpochIterations(1000).run("eho::CList: accumulate", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(
+                        std::accumulate(lstContiguous.begin(), lstContiguous.end(), t_tTestType{}));
+            });
+            BIterate().minEpochIterations(1000).run("eho::CListLinked: accumulate", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(
+                        std::accumulate(lstLinked.begin(), lstLinked.end(), t_tTestType{}));
+            });
+        }
+    }
+
+    template<typename t_tList>
+    void BenchmarkSmallLists(CBenchmark &Benchmark, const std::string &strName, size_t uNumLists, size_t uItems) {
+        Benchmark().run(strName, [&]() {
+            uint64_t uSum = 0;
+            for (size_t i = 0; i < uNumLists; ++i) {
+                t_tList lst{};
+                for (size_t j = 0; j < uItems; ++j) {
+                    lst.emplace_back(static_cast<uint32_t>(j));
+                }
+                uSum += std::accumulate(lst.begin(), lst.end(), uint64_t{0});
+            }
+            ankerl::nanobench::doNotOptimizeAway(uSum);
+        });
+    }
+
+    TEST_CASE("Small list benchmark") {
+        /**
+         * Builds and sums many short lived lists with less than 16 elements,
+         * the small list never touches the heap while they fit the inline buffer.
+         */
+        constexpr size_t uNumLists = 10000;
+        for (size_t uItems: {4, 15}) {
+            CBenchmark BSmall{"Small lists of " + std::to_string(uItems) + " uint32_t"};
+            BenchmarkSmallLists<std::vector<uint32_t>>(BSmall, "std::vector", uNumLists, uItems);
+            BenchmarkSmallLists<eho::CList<uint32_t, eho::Growth::CAmortized>>(
+                    BSmall, "eho::CList", uNumLists, uItems);
+            BenchmarkSmallLists<eho::CListSmall<uint32_t, 16>>(BSmall, "eho::CListSmall<16>", uNumLists, uItems);
+            BenchmarkSmallLists<eho::CListSmall<uint32_t, 4, eho::Growth::CAmortized>>(
+                    BSmall, "eho::CListSmall<4>", uNumLists, uItems);
+        }
+    }
+
+    TEST_CASE("Huge list benchmark") {
+        /**
+         * Appends 10^8 elements one by one, every growth of the default list reallocates the buffer
+         * while the memory mapped list remaps its pages.
+         */
+        constexpr size_t uNumItems = 100'000'000;
+        CBenchmark BHuge{"Huge list: 10^8 uint64_t insertions"};
+        BHuge().epochs(1).epochIterations(1);
+
+        BHuge().run("std::vector: push_back", [&]() {
+            std::vector<uint64_t> vec{};
+            for (size_t i = 0; i < uNumItems; ++i) {
+                vec.push_back(i);
+            }
+            ankerl::nanobench::doNotOptimizeAway(vec.back());
+        });
+        BHuge().run("eho::CList: insert", [&]() {
+            eho::CList<uint64_t, eho::Growth::CAmortized> lst{};
+            for (size_t i = 0; i < uNumItems; ++i) {
+                lst.insert(i);
+            }
+            ankerl::nanobench::doNotOptimizeAway(lst[uNumItems - 1]);
+        });
+        BHuge().run("eho::CListHuge: insert", [&]() {
+            eho::CListHuge<uint64_t> lst{};
+            for (size_t i = 0; i < uNumItems; ++i) {
+                lst.insert(i);
+            }
+            ankerl::nanobench::doNotOptimizeAway(lst[uNumItems - 1]);
+        });
+
+        CBenchmark BSum{"Huge list: 10^8 uint64_t accumulate"};
+        BSum().epochs(3).epochIterations(1);
+        {
+            eho::CList<uint64_t, eho::Growth::CAmortized> lst{};
+            lst.append_range(std::views::iota(uint64_t{0}, uint64_t{uNumItems}));
+            BSum().run("eho::CList: accumulate", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(std::accumulate(lst.begin(), lst.end(), uint64_t{0}));
+            });
+        }
+        {
+            eho::CListHuge<uint64_t> lst{};
+            lst.append_range(std::views::iota(uint64_t{0}, uint64_t{uNumItems}));
+            BSum().run("eho::CListHuge: accumulate", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(std::accumulate(lst.begin(), lst.end(), uint64_t{0}));
+            });
+        }
+    }
+
+    TEST_CASE("Segmented list benchmark") {
+        /**
+         * The segmented list allocates a block per growth and never moves the elements,
+         * the others move the whole buffer. Reads go through the block table.
+         */
+        constexpr size_t uNumItems = 1'000'000;
+        CBenchmark BPush{"Segmented list: 10^6 std::string insertions"};
+        BPush().minEpochIterations(3);
+        BPush().run("std::vector: push_back", [&]() {
+            std::vector<std::string> vec{};
+            for (size_t i = 0; i < uNumItems; ++i) {
+                vec.push_back("127893498ajkshdjkvxcjkb__89iow37e");
+            }
+            ankerl::nanobench::doNotOptimizeAway(vec.back());
+        });
+        BPush().run("eho::CList: insert", [&]() {
+            eho::CList<std::string, eho::Growth::CAmortized> lst{};
+            for (size_t i = 0; i < uNumItems; ++i) {
+                lst.insert("127893498ajkshdjkvxcjkb__89iow37e");
+            }
+            ankerl::nanobench::doNotOptimizeAway(lst[uNumItems - 1]);
+        });
+        BPush().run("eho::CListSegmented: insert", [&]() {
+            eho::CListSegmented<std::string> lst{};
+            for (size_t i = 0; i < uNumItems; ++i) {
+                lst.insert("127893498ajkshdjkvxcjkb__89iow37e");
+            }
+            ankerl::nanobench::doNotOptimizeAway(lst[uNumItems - 1]);
+        });
+
+        std::vector<uint64_t> vecValues(uNumItems);
+        std::mt19937_64 Generator{42};
+        std::ranges::generate(vecValues, Generator);
+        eho::CList<uint64_t> lst{};
+        lst.append_range(vecValues);
+        eho::CListSegmented<uint64_t> lstSegmented{};
+        lstSegmented.append_range(vecValues);
+
+        CBenchmark BRead{"Segmented list: 10^6 uint64_t algorithms"};
+        BRead().minEpochIterations(5);
+        BRead().run("eho::CList: accumulate", [&]() {
+            ankerl::nanobench::doNotOptimizeAway(std::accumulate(lst.begin(), lst.end(), uint64_t{0}));
+        });
+        BRead().run("eho::CListSegmented: accumulate", [&]() {
+            ankerl::nanobench::doNotOptimizeAway(
+                    std::accumulate(lstSegmented.begin(), lstSegmented.end(), uint64_t{0}));
+        });
+        BRead().run("eho::CList: random access", [&]() {
+            uint64_t uSum = 0;
+            for (size_t i = 0; i < uNumItems; i += 7) {
+                uSum += lst[(i * 7919) % uNumItems];
+            }
+            ankerl::nanobench::doNotOptimizeAway(uSum);
+        });
+        BRead().run("eho::CListSegmented: random access", [&]() {
+            uint64_t uSum = 0;
+            for (size_t i = 0; i < uNumItems; i += 7) {
+                uSum += lstSegmented[(i * 7919) % uNumItems];
+            }
+            ankerl::nanobench::doNotOptimizeAway(uSum);
+        });
+        BRead().run("eho::CList: sort", [&]() {
+            std::ranges::copy(vecValues, lst.begin());
+            std::sort(lst.begin(), lst.end());
+        });
+        BRead().run("eho::CListSegmented: sort", [&]() {
+            std::ranges::copy(vecValues, lstSegmented.begin());
+            std::sort(lstSegmented.begin(), lstSegmented.end());
+        });
+    }
+
+    TEST_CASE("Ring list benchmark") {
+        /**
+         * Queue workload: push at the back and pop at the front of a queue holding uQueueSize elements.
+         * The list shifts the whole queue on every pop(0), the ring only moves its head.
+         */
+        constexpr size_t uOperations = 100'000;
+        for (size_t uQueueSize: {16, 1024}) {
+            CBenchmark BQueue{"Queue of " + std::to_string(uQueueSize) + " uint64_t"};
+            BQueue().run("std::deque: push_back/pop_front", [&]() {
+                std::deque<uint64_t> deq(uQueueSize, 0);
+                uint64_t uSum = 0;
+                for (size_t i = 0; i < uOperations; ++i) {
+                    deq.push_back(i);
+                    uSum += deq.front();
+                    deq.pop_front();
+                }
+                ankerl::nanobench::doNotOptimizeAway(uSum);
+            });
+            BQueue().run("eho::CList: insert/pop(0)", [&]() {
+                eho::CList<uint64_t, eho::Growth::CAmortized> lst{};
+                lst.append_range(std::vector<uint64_t>(uQueueSize, 0));
+                uint64_t uSum = 0;
+                for (size_t i = 0; i < uOperations; ++i) {
+                    lst.insert(i);
+                    uSum += *lst.pop(0);
+                }
+                ankerl::nanobench::doNotOptimizeAway(uSum);
+            });
+            BQueue().run("eho::CListRing: push_back/pop_front", [&]() {
+                eho::CListRing<uint64_t> lst{};
+                for (size_t i = 0; i < uQueueSize; ++i) {
+                    lst.push_back(0);
+                }
+                uint64_t uSum = 0;
+                for (size_t i = 0; i < uOperations; ++i) {
+                    lst.push_back(i);
+                    uSum += *lst.pop_front();
+                }
+                ankerl::nanobench::doNotOptimizeAway(uSum);
+            });
+            BQueue().run("eho::CListRingStatic: push_back/pop_front", [&]() {
+                auto pRing = std::make_unique<eho::CListRingStatic<uint64_t, 1025>>();
+                for (size_t i = 0; i < uQueueSize; ++i) {
+                    pRing->push_back(0);
+                }
+                uint64_t uSum = 0;
+                for (size_t i = 0; i < uOperations; ++i) {
+                    pRing->push_back(i);
+                    uSum += *pRing->pop_front();
+                }
+                ankerl::nanobench::doNotOptimizeAway(uSum);
+            });
+        }
+    }
+
+    /**
+     * Edits a text of uSize characters like an editor: bursts of typing and deleting around a cursor
+     * that jumps to a random position every uBurst edits.
+     */
+    template<typename t_tList>
+    void BenchmarkCursorEdits(CBenchmark &Bench, const std::string &strName, size_t uSize, size_t uBurst) {
+        Bench().run(strName, [&]() {
+            t_tList lst{};
+            for (size_t i = 0; i < uSize; ++i) {
+                lst.insert(static_cast<char>('a' + i % 26));
+            }
+            std::mt19937 Generator{11};
+            size_t uCursor = uSize / 2;
+            for (size_t i = 0; i < 20'000; ++i) {
+                if (i % uBurst == 0) {
+                    uCursor = Generator() % (lst.size() + 1);
+                }
+                if (i % 4 == 3 && uCursor > 0) {
+                    lst.pop(--uCursor);
+                } else {
+                    lst.insert(uCursor++, static_cast<char>('a' + i % 26));
+                }
+            }
+            ankerl::nanobench::doNotOptimizeAway(lst[lst.size() / 2]);
+        });
+    }
+
+    TEST_CASE("Gap list benchmark") {
+        /**
+         * Cursor local insert streams, the list shifts the whole tail on every edit
+         * while the gap buffer only moves the elements between two cursor positions.
+         */
+        for (size_t uSize: {10'000, 1'000'000}) {
+            CBenchmark BEdits{"Cursor edits on " + std::to_string(uSize) + " chars"};
+            BEdits().minEpochIterations(3);
+            BenchmarkCursorEdits<eho::CList<char, eho::Growth::CAmortized>>(BEdits, "eho::CList", uSize, 1000);
+            BenchmarkCursorEdits<eho::CListGap<char>>(BEdits, "eho::CListGap: jump every 1000 edits", uSize, 1000);
+            BenchmarkCursorEdits<eho::CListGap<char>>(BEdits, "eho::CListGap: jump every 50 edits", uSize, 50);
+        }
+    }
+
+
+    TEST_CASE("Bit list benchmark") {
+        /**
+         * Per entity flag columns: a byte per flag, std::vector<bool> scanned a bit at a time,
+         * and the packed list processing a word at a time. The only set flag of find is the last one.
+         */
+        constexpr size_t uNumItems = 10'000'000;
+        std::mt19937 Generator{42};
+        std::vector<uint8_t> vecFlags(uNumItems);
+        std::ranges::generate(vecFlags, [&]() { return static_cast<uint8_t>(Generator() % 2); });
+
+        eho::CList<uint8_t> lstBytes{}, lstOtherBytes{};
+        lstBytes.append_range(vecFlags);
+        lstOtherBytes.append_range(vecFlags | std::views::reverse);
+        std::vector<bool> vecBits(vecFlags.begin(), vecFlags.end()), vecOtherBits(vecFlags.rbegin(), vecFlags.rend());
+        eho::CList<bool> lstBits{}, lstOtherBits{};
+        lstBits.append_range(vecBits);
+        lstOtherBits.append_range(vecOtherBits);
+
+        CBenchmark BCount{"Count of 10^7 flags"};
+        BCount().unit("flag").batch(uNumItems).minEpochIterations(5);
+        BCount().run("eho::CList<uint8_t>", [&]() {
+            ankerl::nanobench::doNotOptimizeAway(std::ranges::count(lstBytes, uint8_t{1}));
+        });
+        BCount().run("std::vector<bool>", [&]() {
+            ankerl::nanobench::doNotOptimizeAway(std::ranges::count(vecBits, true));
+        });
+        BCount().run("eho::CList<bool>", [&]() { ankerl::nanobench::doNotOptimizeAway(lstBits.count()); });
+
+        CBenchmark BAnd{"And of 10^7 flags"};
+        BAnd().unit("flag").batch(uNumItems).minEpochIterations(5);
+        BAnd().run("eho::CList<uint8_t>", [&]() {
+            std::ranges::transform(lstBytes, lstOtherBytes, lstBytes.begin(), std::bit_and<uint8_t>{});
+            ankerl::nanobench::doNotOptimizeAway(lstBytes.data());
+        });
+        BAnd().run("std::vector<bool>", [&]() {
+            std::transform(vecBits.begin(), vecBits.end(), vecOtherBits.begin(), vecBits.begin(), std::bit_and<bool>{});
+            ankerl::nanobench::doNotOptimizeAway(vecBits.front());
+        });
+        BAnd().run("eho::CList<bool>", [&]() {
+            lstBits &= lstOtherBits;
+            ankerl::nanobench::doNotOptimizeAway(lstBits.words().data());
+        });
+
+        std::ranges::fill(lstBytes, uint8_t{0});
+        lstBytes[uNumItems - 1] = 1;
+        std::fill(vecBits.begin(), vecBits.end(), false);
+        vecBits.back() = true;
+        std::ranges::fill(lstBits, false);
+        lstBits[uNumItems - 1] = true;
+
+        CBenchmark BFind{"Find the first set of 10^7 flags"};
+        BFind().unit("flag").batch(uNumItems).minEpochIterations(5);
+        BFind().run("eho::CList<uint8_t>", [&]() {
+            ankerl::nanobench::doNotOptimizeAway(std::ranges::find(lstBytes, uint8_t{1}) - lstBytes.begin());
+        });
+        BFind().run("std::vector<bool>", [&]() {
+            ankerl::nanobench::doNotOptimizeAway(std::ranges::find(vecBits, true) - vecBits.begin());
+        });
+        BFind().run("eho::CList<bool>", [&]() { ankerl::nanobench::doNotOptimizeAway(lstBits.find_first()); });
+        BFind().run("eho::CList<bool>: any", [&]() { ankerl::nanobench::doNotOptimizeAway(lstBits.any()); });
+    }
+    /**
+     * Pushes uNumItems log records split between uNumThreads threads through Push(uRecord).
+     */
+    template<typename t_tPush>
+    void ConcurrentAppends(size_t uNumThreads, size_t uNumItems, t_tPush Push) {
+        std::vector<std::thread> vecThreads{};
+        for (size_t uThread = 0; uThread < uNumThreads; ++uThread) {
+            vecThreads.emplace_back([&, uThread]() {
+                size_t uEnd = uNumItems * (uThread + 1) / uNumThreads;
+                for (uint64_t i = uNumItems * uThread / uNumThreads; i < uEnd; ++i) {
+                    Push(i);
+                }
+            });
+        }
+        for (auto &Thread: vecThreads) {
+            Thread.join();
+        }
+    }
+
+    TEST_CASE("Concurrent list benchmark") {
+        /**
+         * Shared log buffer: the threads append under a mutex to a CList,
+         * or claim their slots with a fetch_add in the concurrent list.
+         */
+        constexpr size_t uNumItems = 1'000'000;
+        size_t uNumCores = std::max(1u, std::thread::hardware_concurrency());
+        for (size_t uThreads = 1;; uThreads = std::min(uThreads * 2, uNumCores)) {
+            CBenchmark BAppend{"Concurrent appends: 10^6 uint64_t, " + std::to_string(uThreads) + " threads"};
+            BAppend().unit("item").batch(uNumItems).minEpochIterations(3);
+            BAppend().run("std::mutex + eho::CList: insert", [&]() {
+                std::mutex Mutex{};
+                eho::CList<uint64_t, eho::Growth::CAmortized> lst{};
+                ConcurrentAppends(uThreads, uNumItems, [&](uint64_t uRecord) {
+                    std::scoped_lock Lock{Mutex};
+                    lst.insert(uRecord);
+                });
+                ankerl::nanobench::doNotOptimizeAway(lst.size());
+            });
+            BAppend().run("eho::CListConcurrent: push_back", [&]() {
+                auto pList = std::make_unique<eho::CListConcurrent<uint64_t>>();
+                ConcurrentAppends(uThreads, uNumItems, [&](uint64_t uRecord) {
+                    pList->push_back(uRecord);
+                });
+                ankerl::nanobench::doNotOptimizeAway(pList->size());
+            });
+            BAppend().run("eho::CListConcurrent: reserve + push_back", [&]() {
+                auto pList = std::make_unique<eho::CListConcurrent<uint64_t>>();
+                pList->reserve(uNumItems);
+                ConcurrentAppends(uThreads, uNumItems, [&](uint64_t uRecord) {
+                    pList->push_back(uRecord);
+                });
+                ankerl::nanobench::doNotOptimizeAway(pList->size());
+            });
+            if (uThreads == uNumCores) {
+                break;
+            }
+        }
+    }
+
+    TEST_CASE("Copy-on-write list benchmark") {
+        /**
+         * A writer publishing consistent versions of 10^6 elements: a full copy of a CList per version,
+         * against a snapshot sharing the blocks of the copy-on-write list.
+         */
+        constexpr size_t uNumItems = 1'000'000;
+        std::mt19937_64 Generator{42};
+        eho::CList<uint64_t, eho::Growth::CAmortized> lst{};
+        eho::CListCow<uint64_t> lstCow{};
+        for (size_t i = 0; i < uNumItems; ++i) {
+            lst.insert(i);
+            lstCow.push_back(i);
+        }
+
+        CBenchmark BSnapshot{"Snapshot of 10^6 uint64_t"};
+        BSnapshot().unit("snapshot").minEpochIterations(5);
+        BSnapshot().run("eho::CList: copy", [&]() {
+            eho::CList<uint64_t, eho::Growth::CAmortized> lstCopy{};
+            lstCopy.append_range(lst);
+            ankerl::nanobench::doNotOptimizeAway(lstCopy.data());
+        });
+        BSnapshot().run("eho::CListCow: snapshot", [&]() {
+            auto Snapshot = lstCow.snapshot();
+            ankerl::nanobench::doNotOptimizeAway(Snapshot.size());
+        });
+
+        /**
+         * A version is published, then the writer updates uWrites random elements.
+         */
+        for (size_t uWrites: {1, 100, 10'000}) {
+            CBenchmark BWrite{"Snapshot then " + std::to_string(uWrites) + " random writes in 10^6 uint64_t"};
+            BWrite().unit("version").minEpochIterations(5);
+            std::vector<size_t> vecIndices(uWrites);
+            for (auto &uIndex: vecIndices) {
+                uIndex = Generator() % uNumItems;
+            }
+            BWrite().run("eho::CList: copy + writes", [&]() {
+                eho::CList<uint64_t, eho::Growth::CAmortized> lstCopy{};
+                lstCopy.append_range(lst);
+                for (size_t uIndex: vecIndices) {
+                    ++lst[uIndex];
+                }
+                ankerl::nanobench::doNotOptimizeAway(lstCopy.data());
+            });
+            BWrite().run("eho::CListCow: snapshot + writes", [&]() {
+                auto Snapshot = lstCow.snapshot();
+                for (size_t uIndex: vecIndices) {
+                    ++lstCow[uIndex];
+                }
+                ankerl::nanobench::doNotOptimizeAway(Snapshot.size());
+            });
+            BWrite().run("eho::CListCow: writes, no snapshot", [&]() {
+                for (size_t uIndex: vecIndices) {
+                    ++lstCow[uIndex];
+                }
+                ankerl::nanobench::doNotOptimizeAway(lstCow.size());
+            });
+        }
+    }
 }
@@ -0,0 +1,80 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <Containers/List.hpp>
+#include <Containers/ListSoA.hpp>
+#include <nanobench/nanobench.h>
+#include <doctest/doctest.h>
+#include <array>
+#include <numeric>
+
+
+TEST_SUITE("") {
+    /**
+     * Record whose hot loops only read the price and the quantity.
+     */
+    struct Order {
+        uint64_t uId;
+        double fPrice;
+        uint32_t uQuantity;
+        char arComment[44];
+    };
+
+    TEST_CASE("Struct of arrays benchmark") {
+        /**
+         * Scans of one or two fields, the struct of arrays only brings their columns through the cache.
+         */
+        constexpr size_t uNumItems = 1'000'000;
+        eho::CList<Order, eho::Growth::CAmortized> lstOrders{};
+        eho::CListSoA<uint64_t, double, uint32_t, std::array<char, 44>> lstColumns{};
+        for (size_t i = 0; i < uNumItems; ++i) {
+            lstOrders.insert(Order{i, static_cast<double>(i % 1000) * 0.25, static_cast<uint32_t>(i % 7), {}});
+            lstColumns.emplace_back(i, static_cast<double>(i % 1000) * 0.25, static_cast<uint32_t>(i % 7),
+                                    std::array<char, 44>{});
+        }
+
+        ankerl::nanobench::Bench BSingle{};
+        BSingle.relative(true).title("Single field scan").minEpochIterations(10);
+        BSingle.run("eho::CList<struct>: sum of prices", [&]() {
+            double fSum = 0;
+            for (const Order &Item: lstOrders) {
+                fSum += Item.fPrice;
+            }
+            ankerl::nanobench::doNotOptimizeAway(fSum);
+        });
+        BSingle.run("eho::CListSoA: sum of prices", [&]() {
+            auto spanPrices = lstColumns.column<1>();
+            double fSum = std::accumulate(spanPrices.begin(), spanPrices.end(), 0.0);
+            ankerl::nanobench::doNotOptimizeAway(fSum);
+        });
+
+        ankerl::nanobench::Bench BTwo{};
+        BTwo.relative(true).title("Two fields scan").minEpochIterations(10);
+        BTwo.run("eho::CList<struct>: total value", [&]() {
+            double fSum = 0;
+            for (const Order &Item: lstOrders) {
+                fSum += Item.fPrice * Item.uQuantity;
+            }
+            ankerl::nanobench::doNotOptimizeAway(fSum);
+        });
+        BTwo.run("eho::CListSoA: total value", [&]() {
+            auto spanPrices = lstColumns.column<1>();
+            auto spanQuantities = lstColumns.column<2>();
+            double fSum = 0;
+            for (size_t i = 0; i < spanPrices.size(); ++i) {
+                fSum += spanPrices[i] * spanQuantities[i];
+            }
+            ankerl::nanobench::doNotOptimizeAway(fSum);
+        });
+        BTwo.run("eho::CListSoA: total value through the iterators", [&]() {
+            double fSum = 0;
+            for (const auto &[uId, fPrice, uQuantity, arComment]: lstColumns) {
+                fSum += fPrice * uQuantity;
+            }
+            ankerl::nanobench::doNotOptimizeAway(fSum);
+        });
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <Containers/List.hpp>
+#include <Containers/Parallel.hpp>
+#include <nanobench/nanobench.h>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <random>
+#include <string>
+
+
+TEST_SUITE("") {
+    TEST_CASE("Parallel algorithms benchmark") {
+        /**
+         * Serial std algorithms, std::execution::par and eho::Parallel on the default pool,
+         * all on the same eho::CList<uint32_t>. The sorts copy the shuffled input back first.
+         */
+        for (size_t uSize: {10'000, 100'000, 1'000'000, 10'000'000, 100'000'000}) {
+            std::vector<uint32_t> vecValues(uSize);
+            std::mt19937 Generator{42};
+            std::ranges::generate(vecValues, Generator);
+            eho::CList<uint32_t> lst{};
+            lst.append_range(vecValues);
+            eho::CList<uint32_t> lstOut{};
+            lstOut.append_range(vecValues);
+            uint32_t uMissing = 0;
+            while (std::ranges::find(vecValues, uMissing) != vecValues.end()) {
+                ++uMissing;
+            }
+
+            std::string strSize = " on " + std::to_string(uSize) + " uint32_t";
+            auto MakeBench = [&](const std::string &strTitle) {
+                ankerl::nanobench::Bench B{};
+                B.relative(true).title(strTitle + strSize).unit("item").batch(uSize).epochs(
+                        uSize >= 10'000'000 ? 3 : 11);
+                return B;
+            };
+
+            auto BSort = MakeBench("Sort");
+            BSort.run("std::sort", [&]() {
+                std::ranges::copy(vecValues, lst.begin());
+                std::sort(lst.begin(), lst.end());
+            });
+            BSort.run("std::sort: std::execution::par", [&]() {
+                std::ranges::copy(vecValues, lst.begin());
+                std::sort(std::execution::par, lst.begin(), lst.end());
+            });
+            BSort.run("eho::Parallel::sort", [&]() {
+                std::ranges::copy(vecValues, lst.begin());
+                eho::Parallel::sort(lst);
+            });
+
+            auto BStableSort = MakeBench("Stable sort");
+            BStableSort.run("std::stable_sort", [&]() {
+                std::ranges::copy(vecValues, lst.begin());
+                std::stable_sort(lst.begin(), lst.end());
+            });
+            BStableSort.run("std::stable_sort: std::execution::par", [&]() {
+                std::ranges::copy(vecValues, lst.begin());
+                std::stable_sort(std::execution::par, lst.begin(), lst.end());
+            });
+            BStableSort.run("eho::Parallel::stable_sort", [&]() {
+                std::ranges::copy(vecValues, lst.begin());
+                eho::Parallel::stable_sort(lst);
+            });
+            std::ranges::copy(vecValues, lst.begin());
+
+            auto Square = [](uint32_t i) { return i * i + 1; };
+            auto BTransform = MakeBench("Transform");
+            BTransform.run("std::transform", [&]() {
+                std::transform(lst.begin(), lst.end(), lstOut.begin(), Square);
+                ankerl::nanobench::doNotOptimizeAway(lstOut[uSize / 2]);
+            });
+            BTransform.run("std::transform: std::execution::par", [&]() {
+                std::transform(std::execution::par, lst.begin(), lst.end(), lstOut.begin(), Square);
+                ankerl::nanobench::doNotOptimizeAway(lstOut[uSize / 2]);
+            });
+            BTransform.run("eho::Parallel::transform", [&]() {
+                eho::Parallel::transform(lst, lstOut.begin(), Square);
+                ankerl::nanobench::doNotOptimizeAway(lstOut[uSize / 2]);
+            });
+
+            auto BReduce = MakeBench("Reduce");
+            BReduce.run("std::reduce", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(std::reduce(lst.begin(), lst.end(), uint64_t{0}));
+            });
+            BReduce.run("std::reduce: std::execution::par", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(
+                        std::reduce(std::execution::par, lst.begin(), lst.end(), uint64_t{0}));
+            });
+            BReduce.run("eho::Parallel::reduce", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(eho::Parallel::reduce(lst, uint64_t{0}));
+            });
+
+            auto Increment = [](uint32_t &i) { i += 1; };
+            auto BForEach = MakeBench("For each");
+            BForEach.run("std::for_each", [&]() {
+                std::for_each(lstOut.begin(), lstOut.end(), Increment);
+                ankerl::nanobench::doNotOptimizeAway(lstOut[uSize / 2]);
+            });
+            BForEach.run("std::for_each: std::execution::par", [&]() {
+                std::for_each(std::execution::par, lstOut.begin(), lstOut.end(), Increment);
+                ankerl::nanobench::doNotOptimizeAway(lstOut[uSize / 2]);
+            });
+            BForEach.run("eho::Parallel::for_each", [&]() {
+                eho::Parallel::for_each(lstOut, Increment);
+                ankerl::nanobench::doNotOptimizeAway(lstOut[uSize / 2]);
+            });
+
+            // A value that is not in the list, the whole list is scanned
+            auto BFind = MakeBench("Find");
+            BFind.run("std::find", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(std::find(lst.begin(), lst.end(), uMissing));
+            });
+            BFind.run("std::find: std::execution::par", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(std::find(std::execution::par, lst.begin(), lst.end(), uMissing));
+            });
+            BFind.run("eho::Parallel::find", [&]() {
+                ankerl::nanobench::doNotOptimizeAway(eho::Parallel::find(lst, uMissing));
+            });
+        }
+    }
+}
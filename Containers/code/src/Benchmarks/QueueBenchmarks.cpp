@@ -0,0 +1,281 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <Containers/Queue.hpp>
+#include <Containers/ListRing.hpp>
+#include <nanobench/nanobench.h>
+#include <doctest/doctest.h>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+
+TEST_SUITE("") {
+    /**
+     * Pins the calling thread to one core, wrapped around the available cores.
+     */
+    void PinThread(size_t uCore) {
+#if defined(__linux__)
+        cpu_set_t Set;
+        CPU_ZERO(&Set);
+        CPU_SET(uCore % std::max(1u, std::thread::hardware_concurrency()), &Set);
+        pthread_setaffinity_np(pthread_self(), sizeof(Set), &Set);
+#else
+        (void) uCore;
+#endif
+    }
+
+    /**
+     * Mutex protected circular list, the baseline of the lock-free queue.
+     */
+    template<typename t_tType>
+    class CLockedQueue {
+    public:
+        bool try_push(const t_tType &Item) {
+            std::scoped_lock Lock{m_Mutex};
+            m_lstItems.push_back(Item);
+            return true;
+        }
+
+        std::optional<t_tType> try_pop() {
+            std::scoped_lock Lock{m_Mutex};
+            return m_lstItems.pop_front();
+        }
+
+    private:
+        std::mutex m_Mutex;
+        eho::CListRing<t_tType> m_lstItems;
+    };
+
+    /**
+     * Passes uNumItems from a producer pinned to core 0 to a consumer pinned to core 1.
+     * Both sides yield when the queue is full or empty, the machine may have less cores than threads.
+     */
+    template<typename t_tQueue>
+    void Transfer(t_tQueue &Queue, size_t uNumItems) {
+        std::thread Producer{[&]() {
+            PinThread(0);
+            for (uint64_t i = 0; i < uNumItems;) {
+                if (Queue.try_push(i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }};
+        PinThread(1);
+        uint64_t uSum = 0;
+        for (size_t i = 0; i < uNumItems;) {
+            if (auto Item = Queue.try_pop()) {
+                uSum += *Item;
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        Producer.join();
+        ankerl::nanobench::doNotOptimizeAway(uSum);
+    }
+
+    TEST_CASE("SPSC queue benchmark") {
+        constexpr size_t uNumItems = 1'000'000;
+        constexpr size_t uBatch = 64;
+        auto pQueue = std::make_unique<eho::CQueueSPSC<uint64_t, 4096>>();
+
+        ankerl::nanobench::Bench BThroughput{};
+        BThroughput.relative(true).title("Throughput").unit("item").batch(uNumItems).minEpochIterations(3);
+        BThroughput.run("std::mutex + eho::CListRing", [&]() {
+            CLockedQueue<uint64_t> Queue{};
+            Transfer(Queue, uNumItems);
+        });
+        BThroughput.run("eho::CQueueSPSC", [&]() {
+            Transfer(*pQueue, uNumItems);
+        });
+        BThroughput.run("eho::CQueueSPSC: batches of 64", [&]() {
+            std::thread Producer{[&]() {
+                PinThread(0);
+                std::array<uint64_t, uBatch> arBatch{};
+                for (uint64_t i = 0; i < uNumItems;) {
+                    std::iota(arBatch.begin(), arBatch.end(), i);
+                    size_t uPushed = pQueue->try_push_n(std::span{arBatch}.first(std::min(uBatch, uNumItems - i)));
+                    i += uPushed;
+                    if (uPushed == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            }};
+            PinThread(1);
+            std::array<uint64_t, uBatch> arBatch{};
+            uint64_t uSum = 0;
+            for (size_t i = 0; i < uNumItems;) {
+                size_t uPopped = pQueue->try_pop_n(arBatch);
+                uSum = std::accumulate(arBatch.begin(), arBatch.begin() + uPopped, uSum);
+                i += uPopped;
+                if (uPopped == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            Producer.join();
+            ankerl::nanobench::doNotOptimizeAway(uSum);
+        });
+
+        /**
+         * Round trips of one item through a pair of queues, the echo thread sends back what it receives.
+         */
+        constexpr size_t uNumTrips = 20'000;
+        auto pRequests = std::make_unique<eho::CQueueSPSC<uint64_t, 64>>();
+        auto pReplies = std::make_unique<eho::CQueueSPSC<uint64_t, 64>>();
+        ankerl::nanobench::Bench BLatency{};
+        BLatency.title("Latency").unit("round trip").batch(uNumTrips).minEpochIterations(3);
+        BLatency.run("eho::CQueueSPSC: ping-pong", [&]() {
+            std::thread Echo{[&]() {
+                PinThread(0);
+                for (size_t i = 0; i < uNumTrips;) {
+                    if (auto Item = pRequests->try_pop()) {
+                        while (!pReplies->try_push(*Item)) {
+                            std::this_thread::yield();
+                        }
+                        ++i;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }};
+            PinThread(1);
+            for (uint64_t i = 0; i < uNumTrips; ++i) {
+                pRequests->try_push(i);
+                std::optional<uint64_t> Reply{};
+                while (!(Reply = pReplies->try_pop())) {
+                    std::this_thread::yield();
+                }
+                ankerl::nanobench::doNotOptimizeAway(*Reply);
+            }
+            Echo.join();
+        });
+    }
+
+    /**
+     * Producers push uNumItems between them, consumers pop them, every thread pinned to its own core.
+     * Each side yields when the queue is full or empty, the machine may have less cores than threads.
+     */
+    template<typename t_tQueue>
+    void FanOutFanIn(t_tQueue &Queue, size_t uNumProducers, size_t uNumConsumers, size_t uNumItems) {
+        std::atomic<uint64_t> uSum{0};
+        std::vector<std::thread> vecThreads{};
+        for (size_t uProducer = 0; uProducer < uNumProducers; ++uProducer) {
+            vecThreads.emplace_back([&, uProducer]() {
+                PinThread(uProducer);
+                size_t uEnd = uNumItems * (uProducer + 1) / uNumProducers;
+                for (uint64_t i = uNumItems * uProducer / uNumProducers; i < uEnd;) {
+                    if (Queue.try_push(i)) {
+                        ++i;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (size_t uConsumer = 0; uConsumer < uNumConsumers; ++uConsumer) {
+            vecThreads.emplace_back([&, uConsumer]() {
+                PinThread(uNumProducers + uConsumer);
+                size_t uCount = uNumItems * (uConsumer + 1) / uNumConsumers - uNumItems * uConsumer / uNumConsumers;
+                uint64_t uLocalSum = 0;
+                for (size_t i = 0; i < uCount;) {
+                    if (auto Item = Queue.try_pop()) {
+                        uLocalSum += *Item;
+                        ++i;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                uSum += uLocalSum;
+            });
+        }
+        for (auto &Thread: vecThreads) {
+            Thread.join();
+        }
+        ankerl::nanobench::doNotOptimizeAway(uSum.load());
+    }
+
+    TEST_CASE("MPMC queue benchmark") {
+        constexpr size_t uNumItems = 1'000'000;
+        constexpr size_t uBatch = 64;
+        auto pQueue = std::make_unique<eho::CQueueMPMC<uint64_t, 4096>>();
+        size_t uNumCores = std::max(1u, std::thread::hardware_concurrency());
+
+        /**
+         * Same amount of producers and consumers, doubling up to the core count.
+         */
+        for (size_t uThreads = 1;; uThreads = std::min(uThreads * 2, uNumCores)) {
+            std::string strThreads = std::to_string(uThreads) + "P/" + std::to_string(uThreads) + "C";
+            ankerl::nanobench::Bench B{};
+            B.relative(true).title("Throughput, " + strThreads).unit("item").batch(uNumItems).minEpochIterations(3);
+            B.run("std::mutex + eho::CListRing", [&]() {
+                CLockedQueue<uint64_t> Queue{};
+                FanOutFanIn(Queue, uThreads, uThreads, uNumItems);
+            });
+            B.run("eho::CQueueMPMC", [&]() {
+                FanOutFanIn(*pQueue, uThreads, uThreads, uNumItems);
+            });
+            B.run("eho::CQueueMPMC: blocking batches of 64", [&]() {
+                std::vector<std::thread> vecThreads{};
+                std::atomic<uint64_t> uSum{0};
+                // Every thread moves the same amount of whole batches, so the blocking calls always get a partner
+                size_t uPerThread = uNumItems / uThreads / uBatch * uBatch;
+                for (size_t uProducer = 0; uProducer < uThreads; ++uProducer) {
+                    vecThreads.emplace_back([&, uProducer]() {
+                        PinThread(uProducer);
+                        std::array<uint64_t, uBatch> arBatch{};
+                        for (uint64_t i = 0; i < uPerThread; i += uBatch) {
+                            std::iota(arBatch.begin(), arBatch.end(), i);
+                            pQueue->push_n(arBatch);
+                        }
+                    });
+                }
+                for (size_t uConsumer = 0; uConsumer < uThreads; ++uConsumer) {
+                    vecThreads.emplace_back([&, uConsumer]() {
+                        PinThread(uThreads + uConsumer);
+                        std::array<uint64_t, uBatch> arBatch{};
+                        uint64_t uLocalSum = 0;
+                        for (size_t i = 0; i < uPerThread; i += uBatch) {
+                            pQueue->pop_n(arBatch);
+                            uLocalSum = std::accumulate(arBatch.begin(), arBatch.end(), uLocalSum);
+                        }
+                        uSum += uLocalSum;
+                    });
+                }
+                for (auto &Thread: vecThreads) {
+                    Thread.join();
+                }
+                ankerl::nanobench::doNotOptimizeAway(uSum.load());
+            });
+            if (uThreads == uNumCores) {
+                break;
+            }
+        }
+
+        /**
+         * Unbalanced pipelines, all cores but one on one side.
+         */
+        if (uNumCores > 2) {
+            ankerl::nanobench::Bench B{};
+            B.relative(true).title("Throughput, fan-out and fan-in").unit("item").batch(uNumItems).minEpochIterations(3);
+            B.run("eho::CQueueMPMC: 1 producer", [&]() {
+                FanOutFanIn(*pQueue, 1, uNumCores - 1, uNumItems);
+            });
+            B.run("eho::CQueueMPMC: 1 consumer", [&]() {
+                FanOutFanIn(*pQueue, uNumCores - 1, 1, uNumItems);
+            });
+        }
+    }
+}
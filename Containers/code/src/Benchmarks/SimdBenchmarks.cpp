@@ -0,0 +1,69 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <Containers/List.hpp>
+#include <Containers/Simd.hpp>
+#include <nanobench/nanobench.h>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <typeinfo>
+
+
+TEST_SUITE("") {
+    TEST_CASE_TEMPLATE("SIMD kernels benchmark", t_tTestType, uint32_t, int64_t, float, double) {
+        /**
+         * std::ranges against the kernels of every instruction set the CPU supports.
+         * The searched value is missing, so find and count scan the whole list.
+         */
+        constexpr size_t uNumItems = 1'000'000;
+        eho::CList<t_tTestType> lst{};
+        std::mt19937 Generator{42};
+        for (size_t i = 0; i < uNumItems; ++i) {
+            lst.insert(static_cast<t_tTestType>(Generator() % 1000));
+        }
+        const auto Missing = static_cast<t_tTestType>(1001);
+
+        std::vector<std::pair<std::string, eho::Simd::ELevel>> vecLevels{{"Scalar", eho::Simd::ELevel::Scalar}};
+        for (auto [strName, eLevel]: {std::pair{"SSE", eho::Simd::ELevel::SSE},
+                                      std::pair{"AVX2", eho::Simd::ELevel::AVX2},
+                                      std::pair{"AVX-512", eho::Simd::ELevel::AVX512}}) {
+            if (eLevel <= eho::Simd::level()) {
+                vecLevels.emplace_back(strName, eLevel);
+            }
+        }
+
+        /**
+         * Runs Standard, then Kernel(eLevel) for each instruction set.
+         */
+        auto Compare = [&](const std::string &strOperation, auto Standard, auto Kernel) {
+            ankerl::nanobench::Bench B{};
+            B.relative(true).title(strOperation + " on 10^6 " + typeid(t_tTestType).name()).unit("item")
+                    .batch(uNumItems).minEpochIterations(10);
+            B.run("std::ranges", [&]() { ankerl::nanobench::doNotOptimizeAway(Standard()); });
+            for (const auto &[strName, eLevel]: vecLevels) {
+                B.run("eho::Simd: " + strName, [&]() { ankerl::nanobench::doNotOptimizeAway(Kernel(eLevel)); });
+            }
+        };
+
+        Compare("sum", [&]() { return std::accumulate(lst.begin(), lst.end(), t_tTestType{}); },
+                [&](eho::Simd::ELevel eLevel) { return eho::Simd::sum(lst, eLevel); });
+        Compare("min", [&]() { return std::ranges::min(lst); },
+                [&](eho::Simd::ELevel eLevel) { return *eho::Simd::min(lst, eLevel); });
+        Compare("max", [&]() { return std::ranges::max(lst); },
+                [&](eho::Simd::ELevel eLevel) { return *eho::Simd::max(lst, eLevel); });
+        Compare("minmax", [&]() { return std::ranges::minmax(lst).max; },
+                [&](eho::Simd::ELevel eLevel) { return eho::Simd::minmax(lst, eLevel)->second; });
+        Compare("count", [&]() { return std::ranges::count(lst, Missing); },
+                [&](eho::Simd::ELevel eLevel) { return eho::Simd::count(lst, Missing, eLevel); });
+        Compare("find", [&]() { return std::ranges::find(lst, Missing) - lst.begin(); },
+                [&](eho::Simd::ELevel eLevel) { return eho::Simd::find(lst, Missing, eLevel) - lst.begin(); });
+        Compare("contains", [&]() { return std::ranges::find(lst, Missing) != lst.end(); },
+                [&](eho::Simd::ELevel eLevel) { return eho::Simd::contains(lst, Missing, eLevel); });
+    }
+}
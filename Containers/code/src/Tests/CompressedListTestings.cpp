@@ -0,0 +1,117 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <doctest/doctest.h>
+#include <Containers/CompressedList.hpp>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+
+TEST_SUITE("") {
+    TEST_CASE_TEMPLATE("Compressed list", t_tTestType, uint32_t, uint64_t) {
+        std::mt19937_64 Generator{42};
+
+        /**
+         * Ascending values whose gaps are drawn by Gap().
+         */
+        auto MakeValues = [&](size_t uSize, auto Gap) {
+            std::vector<t_tTestType> vecValues(uSize);
+            t_tTestType Value = 0;
+            for (auto &Item: vecValues) {
+                Value += static_cast<t_tTestType>(Gap());
+                Item = Value;
+            }
+            return vecValues;
+        };
+
+        std::vector<std::pair<std::string, std::vector<t_tTestType>>> vecCases{};
+        vecCases.emplace_back("Empty", std::vector<t_tTestType>{});
+        vecCases.emplace_back("Consecutive", MakeValues(1'000, []() { return 1; }));
+        vecCases.emplace_back("Duplicates", MakeValues(1'000, [&]() { return Generator() % 2; }));
+        vecCases.emplace_back("Small gaps", MakeValues(10'007, [&]() { return Generator() % 16; }));
+        // Mostly small gaps with a few large ones, patched as exceptions
+        vecCases.emplace_back("Outliers", MakeValues(10'000, [&]() {
+            return Generator() % 50 == 0 ? Generator() % 1'000'000 : Generator() % 8;
+        }));
+        vecCases.emplace_back("Full width", std::vector<t_tTestType>{0, 1, std::numeric_limits<t_tTestType>::max()});
+        {
+            std::vector<t_tTestType> vecValues(300);
+            std::ranges::generate(vecValues, [&]() { return static_cast<t_tTestType>(Generator()); });
+            std::ranges::sort(vecValues);
+            vecCases.emplace_back("Random", std::move(vecValues));
+        }
+
+        for (const auto &[strName, vecValues]: vecCases) {
+            CAPTURE(strName);
+            eho::CCompressedList<t_tTestType> lst{};
+            lst.append_range(vecValues);
+            REQUIRE(lst.size() == vecValues.size());
+            CHECK(lst.empty() == vecValues.empty());
+            CHECK(lst.blocks() == (vecValues.size() + 127) / 128);
+            CHECK(std::ranges::equal(lst, vecValues));
+            if (vecValues.empty()) {
+                CHECK(lst.lower_bound(0) == lst.end());
+                continue;
+            }
+            CHECK(lst.front() == vecValues.front());
+            CHECK(lst.back() == vecValues.back());
+            CHECK_THROWS_AS(lst.push_back(vecValues.back() - 1), std::invalid_argument);
+
+            // Every instruction set decodes the same values
+            std::array<t_tTestType, 128> arBlock{};
+            for (auto eLevel: {eho::Simd::ELevel::Scalar, eho::Simd::ELevel::SSE, eho::Simd::ELevel::AVX2,
+                               eho::Simd::ELevel::AVX512}) {
+                for (size_t uBlock = 0; uBlock < lst.blocks(); ++uBlock) {
+                    size_t uCount = lst.decode(uBlock, arBlock.data(), eLevel);
+                    CHECK(std::ranges::equal(arBlock | std::views::take(uCount),
+                                             vecValues | std::views::drop(uBlock * 128) | std::views::take(128)));
+                }
+            }
+            CHECK_THROWS_AS(lst.decode(lst.blocks(), arBlock.data()), std::out_of_range);
+
+            for (size_t i = 0; i < vecValues.size(); i += 7) {
+                for (t_tTestType Value: {vecValues[i], static_cast<t_tTestType>(vecValues[i] + 1),
+                                         static_cast<t_tTestType>(vecValues[i] - 1)}) {
+                    CAPTURE(Value);
+                    auto Expected = std::ranges::lower_bound(vecValues, Value);
+                    auto it = lst.lower_bound(Value);
+                    REQUIRE(std::ranges::distance(lst.begin(), it) == Expected - vecValues.begin());
+                    if (it != lst.end()) {
+                        CHECK(*it == *Expected);
+                        CHECK(std::ranges::equal(std::ranges::subrange(it, lst.end()),
+                                                 std::ranges::subrange(Expected, vecValues.end())));
+                    }
+                    CHECK(lst.contains(Value) == std::ranges::binary_search(vecValues, Value));
+                }
+            }
+
+            lst.clear();
+            CHECK(lst.empty());
+            CHECK(lst.begin() == lst.end());
+        }
+    }
+
+    TEST_CASE("Compressed list - Compression") {
+        // Consecutive IDs need 3 bits per value, the differences are 4 lanes apart
+        eho::CCompressedList<uint32_t> lst{};
+        for (uint32_t i = 0; i < 128'000; ++i) {
+            lst.push_back(1'000'000 + i);
+        }
+        CHECK(lst.compressed_size() * 7 < 128'000 * sizeof(uint32_t));
+
+        // A large gap in every block is stored as an exception instead of widening the block
+        eho::CCompressedList<uint64_t> lstOutliers{};
+        uint64_t uValue = 0;
+        for (size_t i = 0; i < 128'000; ++i) {
+            uValue += i % 128 == 64 ? uint64_t{1} << 40 : 1;
+            lstOutliers.push_back(uValue);
+        }
+        CHECK(lstOutliers.compressed_size() * 8 < 128'000 * sizeof(uint64_t));
+        // The second gap is at 192, after 190 steps of 1
+        CHECK(*lstOutliers.lower_bound(uint64_t{1} << 41) == (uint64_t{1} << 41) + 191);
+    }
+}
@@ -0,0 +1,183 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <doctest/doctest.h>
+#include <Containers/FlatMap.hpp>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+
+/**
+ * Value whose copies throw while s_bThrow is set.
+ */
+struct ThrowingValue {
+    static inline bool s_bThrow = false;
+    int m_iValue = 0;
+
+    ThrowingValue() = default;
+
+    ThrowingValue(int iValue) : m_iValue{iValue} {}
+
+    ThrowingValue(const ThrowingValue &Other) : m_iValue{Other.m_iValue} {
+        if (s_bThrow) {
+            throw std::runtime_error{"Copy failed"};
+        }
+    }
+
+    ThrowingValue &operator=(const ThrowingValue &) = default;
+
+    bool operator==(const ThrowingValue &) const = default;
+};
+
+TEST_SUITE("") {
+    TEST_CASE_TEMPLATE("Flat set", t_tLayout, eho::Layout::CSorted, eho::Layout::CEytzinger) {
+        std::mt19937 Generator{42};
+
+        for (size_t uSize: {0, 1, 2, 7, 1'000, 100'003}) {
+            CAPTURE(uSize);
+            // Even keys with duplicates, so the odd ones are missing between them
+            std::vector<uint32_t> vecKeys(uSize);
+            std::ranges::generate(vecKeys, [&]() { return Generator() % (uSize + 1) * 2; });
+            std::set<uint32_t> Expected(vecKeys.begin(), vecKeys.end());
+
+            eho::CFlatSet<uint32_t, t_tLayout> Set{vecKeys};
+            REQUIRE(Set.size() == Expected.size());
+            CHECK(Set.empty() == Expected.empty());
+            CHECK(std::ranges::is_permutation(Set, Expected));
+            if constexpr (std::is_same_v<t_tLayout, eho::Layout::CSorted>) {
+                CHECK(std::ranges::equal(Set, Expected));
+            }
+
+            for (uint32_t uKey = 0; uKey <= uSize * 2 + 2; uKey += uSize < 1'000 ? 1 : 97) {
+                CAPTURE(uKey);
+                CHECK(Set.contains(uKey) == Expected.contains(uKey));
+                auto Found = Set.find(uKey);
+                CHECK((Found != Set.end()) == Expected.contains(uKey));
+                if (Found != Set.end()) {
+                    CHECK(*Found == uKey);
+                }
+
+                auto Bound = Set.lower_bound(uKey);
+                auto ExpectedBound = Expected.lower_bound(uKey);
+                REQUIRE((Bound == Set.end()) == (ExpectedBound == Expected.end()));
+                if (Bound != Set.end()) {
+                    CHECK(*Bound == *ExpectedBound);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("Flat set - Sorted insertions and removals") {
+        eho::CFlatSet<std::string> Set{"b", "d", "a", "d"};
+        CHECK(std::ranges::equal(Set, std::vector<std::string>{"a", "b", "d"}));
+
+        CHECK(Set.insert("c"));
+        CHECK_FALSE(Set.insert("b"));
+        CHECK(Set.insert("e"));
+        CHECK(Set.insert(""));
+        CHECK(std::ranges::equal(Set, std::vector<std::string>{"", "a", "b", "c", "d", "e"}));
+
+        CHECK(Set.erase("a"));
+        CHECK_FALSE(Set.erase("a"));
+        CHECK(Set.erase("e"));
+        CHECK(std::ranges::equal(Set, std::vector<std::string>{"", "b", "c", "d"}));
+        CHECK(*Set.lower_bound("bb") == "c");
+
+        // Descending order
+        eho::CFlatSet<int, eho::Layout::CEytzinger, std::greater<>> Descending{std::vector{1, 5, 3, 9, 7}};
+        CHECK(*Descending.lower_bound(6) == 5);
+        CHECK(Descending.lower_bound(0) == Descending.end());
+        CHECK(Descending.contains(9));
+
+        Set.clear();
+        CHECK(Set.empty());
+        CHECK(Set.find("b") == Set.end());
+    }
+
+    TEST_CASE_TEMPLATE("Flat map", t_tLayout, eho::Layout::CSorted, eho::Layout::CEytzinger) {
+        std::mt19937 Generator{42};
+        std::vector<std::pair<uint64_t, std::string>> vecItems{};
+        std::map<uint64_t, std::string> Expected{};
+        for (size_t i = 0; i < 10'000; ++i) {
+            uint64_t uKey = Generator() % 20'000;
+            vecItems.emplace_back(uKey, std::to_string(i));
+            // The first value of a duplicated key is kept
+            Expected.emplace(uKey, std::to_string(i));
+        }
+
+        eho::CFlatMap<uint64_t, std::string, t_tLayout> Map{vecItems};
+        REQUIRE(Map.size() == Expected.size());
+        REQUIRE(Map.keys().size() == Map.values().size());
+        for (size_t i = 0; i < Map.size(); ++i) {
+            CHECK(Expected.at(Map.keys()[i]) == Map.values()[i]);
+        }
+
+        for (uint64_t uKey = 0; uKey < 20'002; ++uKey) {
+            auto It = Expected.find(uKey);
+            if (It == Expected.end()) {
+                CHECK_FALSE(Map.contains(uKey));
+                CHECK(Map.find(uKey) == nullptr);
+                CHECK_THROWS_AS(Map.at(uKey), std::out_of_range);
+            } else {
+                REQUIRE(Map.find(uKey) != nullptr);
+                CHECK(*Map.find(uKey) == It->second);
+                CHECK(Map.at(uKey) == It->second);
+            }
+
+            size_t uBound = Map.lower_bound(uKey);
+            auto ExpectedBound = Expected.lower_bound(uKey);
+            REQUIRE((uBound == Map.size()) == (ExpectedBound == Expected.end()));
+            if (uBound != Map.size()) {
+                CHECK(Map.keys()[uBound] == ExpectedBound->first);
+            }
+        }
+
+        Map.at(vecItems.front().first) = "Changed";
+        CHECK(*Map.find(vecItems.front().first) == "Changed");
+    }
+
+    TEST_CASE("Flat map - Sorted insertions and removals") {
+        eho::CFlatMap<std::string, int> Map{{"b", 2}, {"a", 1}, {"b", 3}};
+        CHECK(std::ranges::equal(Map.keys(), std::vector<std::string>{"a", "b"}));
+        CHECK(std::ranges::equal(Map.values(), std::vector{1, 2}));
+
+        CHECK(Map.insert("c", 3));
+        CHECK_FALSE(Map.insert("a", 10));
+        CHECK(Map.at("a") == 1);
+        Map["0"] += 5;
+        Map["a"] += 5;
+        CHECK(std::ranges::equal(Map.keys(), std::vector<std::string>{"0", "a", "b", "c"}));
+        CHECK(std::ranges::equal(Map.values(), std::vector{5, 6, 2, 3}));
+
+        CHECK(Map.erase("b"));
+        CHECK_FALSE(Map.erase("b"));
+        CHECK(std::ranges::equal(Map.keys(), std::vector<std::string>{"0", "a", "c"}));
+        CHECK(std::ranges::equal(Map.values(), std::vector{5, 6, 3}));
+
+        // values() only exposes the elements, their amount stays the amount of keys
+        std::ranges::fill(Map.values(), 1);
+        CHECK(std::ranges::equal(Map.values(), std::vector{1, 1, 1}));
+
+        Map.clear();
+        CHECK(Map.empty());
+        CHECK(Map.values().empty());
+    }
+
+    TEST_CASE("Flat map - Throwing values") {
+        eho::CFlatMap<int, ThrowingValue> Map{{1, 10}, {3, 30}};
+        ThrowingValue::s_bThrow = true;
+        CHECK_THROWS_AS(Map.insert(2, 20), std::runtime_error);
+        ThrowingValue::s_bThrow = false;
+        // The key of the failed insertion is removed with its value
+        CHECK(Map.keys().size() == Map.values().size());
+        CHECK_FALSE(Map.contains(2));
+        CHECK(Map.at(3) == 30);
+        CHECK(Map.insert(2, 20));
+        CHECK(std::ranges::equal(Map.values(), std::vector<ThrowingValue>{10, 20, 30}));
+    }
+}
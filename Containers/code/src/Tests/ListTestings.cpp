@@ -6,9 +6,171 @@
 
 #include <doctest/doctest.h>
 #include <Containers/List.hpp>
+#include <Containers/ListConcurrent.hpp>
+#include <Containers/ListCow.hpp>
+#include <Containers/ListGap.hpp>
+#include <Containers/ListRing.hpp>
+#include <Containers/ListSoA.hpp>
 #include <algorithm>
+#include <deque>
 #include <random>
+#include <ranges>
 #include <format>
+#include <limits>
+#include <list>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+/**
+ * Owns a heap value, moving it with memcpy is safe so it opts in as trivially relocatable.
+ */
+class RelocatableHandle {
+public:
+    RelocatableHandle() = default;
+
+    RelocatableHandle(uint32_t i) : m_pValue{std::make_unique<uint32_t>(i)} {}
+
+    RelocatableHandle(const RelocatableHandle &Other) : m_pValue{std::make_unique<uint32_t>(Other.Get())} {}
+
+    RelocatableHandle(RelocatableHandle &&) = default;
+
+    RelocatableHandle &operator=(const RelocatableHandle &Other) {
+        m_pValue = std::make_unique<uint32_t>(Other.Get());
+        return *this;
+    }
+
+    RelocatableHandle &operator=(RelocatableHandle &&) = default;
+
+    bool operator==(const RelocatableHandle &Other) const {
+        return Other.Get() == this->Get();
+    }
+
+    uint32_t Get() const {
+        return m_pValue ? *m_pValue : 0;
+    }
+
+private:
+    std::unique_ptr<uint32_t> m_pValue;
+};
+
+template<>
+struct eho::is_trivially_relocatable<RelocatableHandle> : std::true_type {
+};
+
+/**
+ * Owns a heap value and is trivially relocatable, its copies and moves throw once s_uLeft runs out.
+ * Destroying a slot that holds no element frees a value twice.
+ */
+class ThrowingHandle {
+public:
+    inline static size_t s_uLeft = std::numeric_limits<size_t>::max();
+
+    ThrowingHandle(uint32_t i) : m_pValue{std::make_unique<uint32_t>(i)} {}
+
+    ThrowingHandle(const ThrowingHandle &Other) : m_pValue{(Count(), std::make_unique<uint32_t>(Other.Get()))} {}
+
+    ThrowingHandle(ThrowingHandle &&Other) : m_pValue{(Count(), std::move(Other.m_pValue))} {}
+
+    ThrowingHandle &operator=(const ThrowingHandle &Other) {
+        m_pValue = std::make_unique<uint32_t>(Other.Get());
+        return *this;
+    }
+
+    ThrowingHandle &operator=(ThrowingHandle &&) = default;
+
+    bool operator==(const ThrowingHandle &Other) const {
+        return Other.Get() == this->Get();
+    }
+
+    uint32_t Get() const {
+        return m_pValue ? *m_pValue : 0;
+    }
+
+private:
+    std::unique_ptr<uint32_t> m_pValue;
+
+    static void Count() {
+        if (s_uLeft == 0) {
+            throw std::runtime_error{"Construction failed"};
+        }
+        s_uLeft -= 1;
+    }
+};
+
+template<>
+struct eho::is_trivially_relocatable<ThrowingHandle> : std::true_type {
+};
+
+/**
+ * Counts the copies and moves, to verify the elements are built in place.
+ */
+class CopyCounter {
+public:
+    inline static size_t s_uCopies = 0;
+    inline static size_t s_uMoves = 0;
+
+    CopyCounter(uint32_t i) : m_uInt{i} {}
+
+    CopyCounter(const CopyCounter &Other) : m_uInt{Other.m_uInt} {
+        s_uCopies += 1;
+    }
+
+    CopyCounter(CopyCounter &&Other) noexcept: m_uInt{Other.m_uInt} {
+        s_uMoves += 1;
+    }
+
+    CopyCounter &operator=(const CopyCounter &Other) {
+        m_uInt = Other.m_uInt;
+        s_uCopies += 1;
+        return *this;
+    }
+
+    CopyCounter &operator=(CopyCounter &&Other) noexcept {
+        m_uInt = Other.m_uInt;
+        s_uMoves += 1;
+        return *this;
+    }
+
+    static void Reset() {
+        s_uCopies = 0;
+        s_uMoves = 0;
+    }
+
+    uint32_t Get() const {
+        return m_uInt;
+    }
+
+private:
+    uint32_t m_uInt;
+};
+
+/**
+ * Forwards to the default resource and tracks the allocated bytes.
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t m_uAllocations = 0;
+    size_t m_uBytesInUse = 0;
+
+private:
+    void *do_allocate(size_t uBytes, size_t uAlignment) override {
+        m_uAllocations += 1;
+        m_uBytesInUse += uBytes;
+        return std::pmr::new_delete_resource()->allocate(uBytes, uAlignment);
+    }
+
+    void do_deallocate(void *ptr, size_t uBytes, size_t uAlignment) override {
+        m_uBytesInUse -= uBytes;
+        std::pmr::new_delete_resource()->deallocate(ptr, uBytes, uAlignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &Other) const noexcept override {
+        return this == &Other;
+    }
+};
 
 TEST_SUITE("[]") {
     std::random_device RandomDevice;
@@ -212,18 +374,1738 @@ TEST_SUITE("[]") {
                     }
                 }
             }
+            SUBCASE("Range insertion") {
+                std::vector<t_tTestType> vecObjects{GetObjects<t_tTestType>()};
+                std::vector<t_tTestType> vecExpected{};
+
+                lst.append_range(vecObjects);
+                vecExpected.insert(vecExpected.end(), vecObjects.begin(), vecObjects.end());
+                // Grows only once
+                CHECK(lst.capacity() == vecObjects.size());
+                CHECK(std::ranges::equal(lst, vecExpected));
+
+                lst.insert(0, vecObjects.begin(), vecObjects.end());
+                vecExpected.insert(vecExpected.begin(), vecObjects.begin(), vecObjects.end());
+                CHECK(lst.capacity() == vecExpected.size());
+                CHECK(std::ranges::equal(lst, vecExpected));
+
+                std::list<t_tTestType> lstSource{vecObjects.begin(), vecObjects.end()};
+                for (size_t i = 0; i < 100; ++i) {
+                    size_t uIndex = Generator() % (vecExpected.size() + 1);
+                    lst.insert(uIndex, lstSource.begin(), lstSource.end());
+                    vecExpected.insert(vecExpected.begin() + uIndex, lstSource.begin(), lstSource.end());
+                }
+                CHECK(std::ranges::equal(lst, vecExpected));
+
+                lst.insert(1, {vecObjects[0], vecObjects[1]});
+                vecExpected.insert(vecExpected.begin() + 1, {vecObjects[0], vecObjects[1]});
+                CHECK(std::ranges::equal(lst, vecExpected));
+
+                // Empty ranges and single pass ranges
+                lst.insert(0, vecObjects.end(), vecObjects.end());
+                std::istringstream Stream{"1 2 3"};
+                lst.append_range(std::ranges::istream_view<uint32_t>(Stream) |
+                                 std::views::transform([&](uint32_t) { return vecObjects.back(); }));
+                vecExpected.insert(vecExpected.end(), 3, vecObjects.back());
+                CHECK(std::ranges::equal(lst, vecExpected));
+
+                CHECK_THROWS_AS(lst.insert(lst.size() + 1, vecObjects.begin(), vecObjects.end()), std::out_of_range);
+            }
             SUBCASE("Move insertion") {
-                // @todo
+                std::vector<t_tTestType> vecObjects{GetObjects<t_tTestType>()};
+                std::vector<t_tTestType> vecExpected{};
+                for (const auto &Item: vecObjects) {
+                    t_tTestType Copy{Item};
+                    lst.insert(std::move(Copy));
+                    vecExpected.push_back(Item);
+
+                    t_tTestType Copy2{Item};
+                    size_t uIndex = Generator() % lst.size();
+                    lst.insert(uIndex, std::move(Copy2));
+                    vecExpected.insert(vecExpected.begin() + uIndex, Item);
+                }
+                CHECK(std::ranges::equal(lst, vecExpected));
             }
             SUBCASE("Inplace build insertion") {
-                // @todo
+                std::vector<t_tTestType> vecObjects{GetObjects<t_tTestType>()};
+                std::vector<t_tTestType> vecExpected{};
+                for (const auto &Item: vecObjects) {
+                    CHECK(lst.emplace_back(Item) == Item);
+                    vecExpected.push_back(Item);
+
+                    size_t uIndex = Generator() % lst.size();
+                    CHECK(lst.emplace(uIndex, Item) == Item);
+                    vecExpected.insert(vecExpected.begin() + uIndex, Item);
+                }
+                CHECK(std::ranges::equal(lst, vecExpected));
+
+                // Arguments referencing elements of the list, growing or shifting must not invalidate them
+                for (size_t i = 0; i < 20; ++i) {
+                    lst.emplace_back(lst[0]);
+                    vecExpected.push_back(vecExpected[0]);
+                    lst.emplace(0, lst[lst.size() - 1]);
+                    vecExpected.insert(vecExpected.begin(), vecExpected.back());
+                }
+                CHECK(std::ranges::equal(lst, vecExpected));
+
+                CHECK_THROWS_AS(lst.emplace(lst.size() + 1, vecObjects[0]), std::out_of_range);
             }
         }
         SUBCASE("Access") {
             // Already tested with previous test cases
         }
         SUBCASE("Reassign values") {}
-        SUBCASE("Remove") {}
+        SUBCASE("Remove") {
+            std::vector<t_tTestType> vecExpected{};
+            for (size_t i = 0; i < 200; ++i) {
+                vecExpected.push_back(GetRandom<t_tTestType>());
+            }
+            lst.append_range(vecExpected);
+
+            SUBCASE("Pop") {
+                while (!vecExpected.empty()) {
+                    size_t uIndex = Generator() % vecExpected.size();
+                    CHECK(*lst.pop(uIndex) == vecExpected[uIndex]);
+                    vecExpected.erase(vecExpected.begin() + uIndex);
+                }
+                CHECK(lst.empty());
+                CHECK_FALSE(lst.pop(0).has_value());
+            }
+
+            SUBCASE("Range erase") {
+                lst.erase(10, 10);
+                lst.erase(0, 10);
+                vecExpected.erase(vecExpected.begin(), vecExpected.begin() + 10);
+                lst.erase(50, 120);
+                vecExpected.erase(vecExpected.begin() + 50, vecExpected.begin() + 120);
+                lst.erase(lst.size() - 5, lst.size());
+                vecExpected.erase(vecExpected.end() - 5, vecExpected.end());
+                CHECK(std::ranges::equal(lst, vecExpected));
+
+                CHECK_THROWS_AS(lst.erase(0, lst.size() + 1), std::out_of_range);
+                CHECK_THROWS_AS(lst.erase(2, 1), std::out_of_range);
+
+                lst.erase(0, lst.size());
+                CHECK(lst.empty());
+            }
+
+            SUBCASE("Erase if") {
+                t_tTestType Removed{vecExpected[5]};
+                auto uExpected = std::erase(vecExpected, Removed);
+                CHECK(lst.erase_if([&](const t_tTestType &Item) { return Item == Removed; }) == uExpected);
+                CHECK(std::ranges::equal(lst, vecExpected));
+
+                size_t uIndex = 0;
+                std::vector<bool> vecDrop{};
+                for (size_t i = 0; i < vecExpected.size(); ++i) {
+                    vecDrop.push_back(Generator() % 10 < 3);
+                }
+                std::vector<t_tTestType> vecKept{};
+                for (size_t i = 0; i < vecExpected.size(); ++i) {
+                    if (!vecDrop[i]) {
+                        vecKept.push_back(vecExpected[i]);
+                    }
+                }
+                // The predicate is called once per element, in order
+                lst.erase_if([&](const t_tTestType &) { return vecDrop[uIndex++]; });
+                CHECK(uIndex == vecDrop.size());
+                CHECK(std::ranges::equal(lst, vecKept));
+
+                CHECK(lst.erase_if([](const t_tTestType &) { return true; }) == vecKept.size());
+                CHECK(lst.empty());
+            }
+
+            SUBCASE("Swap remove") {
+                while (!vecExpected.empty()) {
+                    size_t uIndex = Generator() % vecExpected.size();
+                    CHECK(*lst.swap_remove(uIndex) == vecExpected[uIndex]);
+                    vecExpected[uIndex] = vecExpected.back();
+                    vecExpected.pop_back();
+                    CHECK(std::ranges::equal(lst, vecExpected));
+                }
+                CHECK_FALSE(lst.swap_remove(0).has_value());
+            }
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Dynamic list - Relocation", t_tTestType, uint32_t, RelocatableHandle, std::string) {
+        static_assert(eho::is_trivially_relocatable_v<uint32_t>);
+        static_assert(eho::is_trivially_relocatable_v<RelocatableHandle>);
+        static_assert(!eho::is_trivially_relocatable_v<std::string>);
+
+        eho::CList<t_tTestType, eho::Growth::CAmortized> lst{};
+        eho::CListLinked<t_tTestType> lstLinked{};
+        std::vector<t_tTestType> vecObjects{};
+
+        auto Random = []() {
+            if constexpr (std::is_same_v<t_tTestType, RelocatableHandle>) {
+                return RelocatableHandle{static_cast<uint32_t>(Generator())};
+            } else {
+                return GetRandom<t_tTestType>();
+            }
+        };
+
+        for (size_t i = 0; i < 500; ++i) {
+            size_t uIndex = i % 3 == 0 ? 0 : Generator() % (vecObjects.size() + 1);
+            auto Value = Random();
+            vecObjects.insert(vecObjects.begin() + uIndex, Value);
+            lst.insert(uIndex, Value);
+            lstLinked.insert(uIndex, Value);
+        }
+        CHECK(std::ranges::equal(lst, vecObjects));
+        CHECK(std::ranges::equal(lstLinked, vecObjects));
+
+        while (!vecObjects.empty()) {
+            size_t uIndex = Generator() % vecObjects.size();
+            CHECK(*lst.pop(uIndex) == vecObjects[uIndex]);
+            CHECK(*lstLinked.pop(uIndex) == vecObjects[uIndex]);
+            vecObjects.erase(vecObjects.begin() + uIndex);
+        }
+        CHECK(lst.empty());
+        CHECK(lstLinked.empty());
+    }
+
+    TEST_CASE_TEMPLATE("Dynamic list - No extra copies", t_tList, eho::CList<CopyCounter>,
+                       eho::CList<CopyCounter, eho::Growth::CAmortized>, eho::CListLinked<CopyCounter>) {
+        t_tList lst{};
+        lst.resize(64);
+        CopyCounter::Reset();
+
+        lst.emplace_back(1u);
+        CHECK(CopyCounter::s_uCopies == 0);
+        CHECK(CopyCounter::s_uMoves == 0);
+
+        // Inserting before other elements builds a temporary, like std::vector::emplace
+        lst.emplace(0, 2u);
+        CHECK(CopyCounter::s_uCopies == 0);
+
+        lst.insert(CopyCounter{3u});
+        lst.insert(0, CopyCounter{4u});
+        CHECK(CopyCounter::s_uCopies == 0);
+
+        CopyCounter Item{5u};
+        lst.insert(Item);
+        CHECK(CopyCounter::s_uCopies == 1);
+
+        CHECK(lst.size() == 5);
+        CHECK(lst[0].Get() == 4);
+        CHECK(lst[1].Get() == 2);
+        CHECK(lst[4].Get() == 5);
+    }
+
+    TEST_CASE("Linked list - Throwing constructions") {
+        eho::CListLinked<ThrowingHandle> lst{};
+        std::vector<ThrowingHandle> vecObjects{};
+        for (uint32_t i = 0; i < 100; ++i) {
+            lst.insert(ThrowingHandle{i});
+            vecObjects.emplace_back(i);
+        }
+
+        // The temporary is moved, then moving it into the opened slot throws
+        for (size_t uIndex: {size_t{0}, size_t{50}, size_t{99}}) {
+            CAPTURE(uIndex);
+            ThrowingHandle::s_uLeft = 1;
+            CHECK_THROWS_AS(lst.insert(uIndex, ThrowingHandle{1000}), std::runtime_error);
+            ThrowingHandle::s_uLeft = std::numeric_limits<size_t>::max();
+            CHECK(lst.size() == vecObjects.size());
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+
+        // Appending after a full node throws, the node linked for it is removed again
+        eho::CListLinked<ThrowingHandle> lstFull{};
+        constexpr size_t uFullNode = eho::Internal::CUnrolledNode<ThrowingHandle>::s_uCapacity;
+        for (uint32_t i = 0; i < uFullNode; ++i) {
+            lstFull.insert(ThrowingHandle{i});
+        }
+        ThrowingHandle Item{1000};
+        ThrowingHandle::s_uLeft = 0;
+        CHECK_THROWS_AS(lstFull.insert(Item), std::runtime_error);
+        ThrowingHandle::s_uLeft = std::numeric_limits<size_t>::max();
+        CHECK(lstFull.size() == uFullNode);
+        CHECK(lstFull.swap_remove(0)->Get() == 0);
+        CHECK(lstFull[0].Get() == uFullNode - 1);
+
+        // A range is inserted into packed nodes, the node at the insertion point is split once
+        std::vector<ThrowingHandle> vecRange{};
+        for (uint32_t i = 0; i < 1000; ++i) {
+            vecRange.emplace_back(1000 + i);
+        }
+        size_t uCapacity = lst.capacity();
+        lst.insert(50, vecRange.begin(), vecRange.end());
+        vecObjects.insert(vecObjects.begin() + 50, vecRange.begin(), vecRange.end());
+        CHECK(std::ranges::equal(lst, vecObjects));
+        constexpr size_t uNodeCapacity = eho::Internal::CUnrolledNode<ThrowingHandle>::s_uCapacity;
+        CHECK(lst.capacity() - uCapacity <= (vecRange.size() / uNodeCapacity + 2) * uNodeCapacity);
+
+        // The elements copied before the throwing one stay inserted, when splitting or shifting the node
+        for (size_t uIndex: {size_t{30}, lst.size() - 2}) {
+            CAPTURE(uIndex);
+            ThrowingHandle::s_uLeft = 5;
+            CHECK_THROWS_AS(lst.insert(uIndex, vecRange.begin(), vecRange.begin() + 20), std::runtime_error);
+            ThrowingHandle::s_uLeft = std::numeric_limits<size_t>::max();
+            vecObjects.insert(vecObjects.begin() + static_cast<std::ptrdiff_t>(uIndex), vecRange.begin(),
+                              vecRange.begin() + 5);
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+        eho::CListLinked<ThrowingHandle> lstSmall{};
+        lstSmall.insert(ThrowingHandle{1});
+        lstSmall.insert(ThrowingHandle{2});
+        ThrowingHandle::s_uLeft = 1;
+        CHECK_THROWS_AS(lstSmall.insert(1, vecRange.begin(), vecRange.begin() + 3), std::runtime_error);
+        ThrowingHandle::s_uLeft = std::numeric_limits<size_t>::max();
+        CHECK(std::ranges::equal(lstSmall, std::vector<ThrowingHandle>{1, 1000, 2}));
+    }
+
+    TEST_CASE_TEMPLATE("Dynamic list - Throwing constructions", t_tList, eho::CList<ThrowingHandle>,
+                       eho::CList<ThrowingHandle, eho::Growth::CDouble>, eho::CListInplace<ThrowingHandle, 16>) {
+        t_tList lst{};
+        std::vector<ThrowingHandle> vecObjects{};
+        for (uint32_t i = 0; i < 4; ++i) {
+            lst.insert(ThrowingHandle{i});
+            vecObjects.emplace_back(i);
+        }
+
+        SUBCASE("Insertion") {
+            // No reallocation, the temporary is moved, then moving it into the opened slot throws
+            lst.resize(16);
+            for (size_t uIndex: {size_t{0}, size_t{2}}) {
+                CAPTURE(uIndex);
+                ThrowingHandle::s_uLeft = 1;
+                CHECK_THROWS_AS(lst.insert(uIndex, ThrowingHandle{1000}), std::runtime_error);
+                ThrowingHandle::s_uLeft = std::numeric_limits<size_t>::max();
+                CHECK(lst.size() == vecObjects.size());
+                CHECK(std::ranges::equal(lst, vecObjects));
+            }
+            lst.insert(2, ThrowingHandle{1000});
+            vecObjects.insert(vecObjects.begin() + 2, ThrowingHandle{1000});
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+
+        SUBCASE("Range insertion") {
+            // The second copy throws, the first one is destroyed and the tail moved back
+            std::vector<ThrowingHandle> vecRange{100, 101, 102};
+            for (size_t uIndex: {size_t{0}, size_t{1}, size_t{4}}) {
+                CAPTURE(uIndex);
+                ThrowingHandle::s_uLeft = 1;
+                CHECK_THROWS_AS(lst.insert(uIndex, vecRange.begin(), vecRange.end()), std::runtime_error);
+                ThrowingHandle::s_uLeft = std::numeric_limits<size_t>::max();
+                CHECK(lst.size() == vecObjects.size());
+                CHECK(std::ranges::equal(lst, vecObjects));
+            }
+            lst.insert(1, vecRange.begin(), vecRange.end());
+            vecObjects.insert(vecObjects.begin() + 1, vecRange.begin(), vecRange.end());
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+    }
+
+    TEST_CASE("Dynamic list - Move only type") {
+        eho::CList<std::unique_ptr<uint32_t>> lst{};
+        eho::CListLinked<std::unique_ptr<uint32_t>> lstLinked{};
+        for (uint32_t i = 0; i < 100; ++i) {
+            lst.insert(std::make_unique<uint32_t>(i));
+            lst.emplace(0, std::make_unique<uint32_t>(i));
+            lstLinked.insert(std::make_unique<uint32_t>(i));
+            lstLinked.emplace(0, new uint32_t{i});
+        }
+        for (uint32_t i = 0; i < 100; ++i) {
+            CHECK(*lst[i] == 99 - i);
+            CHECK(*lst[100 + i] == i);
+            CHECK(*lstLinked[i] == 99 - i);
+            CHECK(*lstLinked[100 + i] == i);
+        }
+        CHECK(**lst.pop() == 99);
+        CHECK(**lstLinked.pop(0) == 99);
+    }
+
+    TEST_CASE("Growth policies") {
+        using namespace eho::Growth;
+        CHECK(CExact<>::Grow(10, 11, 4) == 11);
+        CHECK(CAmortized::Grow(10, 11, 4) == 15);
+        CHECK(CAmortized::Grow(0, 1, 4) == 1);
+        CHECK(CDouble::Grow(10, 11, 4) == 20);
+        CHECK(CPowerOfTwo<>::Grow(10, 11, 4) == 16);
+        CHECK(CPageGranular<CAmortized>::Grow(0, 1, 4) == 1024);
+        CHECK(CPageGranular<CAmortized>::Grow(1024, 1025, 4) == 2048);
+
+        // Hysteresis, only shrinks at 1/4 of the capacity
+        CHECK(CExact<>::Shrink(100, 99, 4) == 100);
+        CHECK(CExact<>::Shrink(100, 26, 4) == 100);
+        CHECK(CExact<>::Shrink(100, 25, 4) == 25);
+        CHECK(CDouble::Shrink(100, 25, 4) == 50);
+        CHECK(CPowerOfTwo<>::Shrink(128, 20, 4) == 32);
+        CHECK(CPageGranular<CAmortized>::Shrink(4096, 100, 4) == 1024);
+        // Tiny capacities are never shrunk
+        CHECK(CExact<>::Shrink(4, 0, 4) == 4);
+        // Shrinking disabled
+        CHECK(CFactor<3, 2, 0>::Shrink(100, 0, 4) == 100);
+    }
+
+    TEST_CASE_TEMPLATE("Dynamic list - Growth policy", t_tPolicy, eho::Growth::CExact<>, eho::Growth::CAmortized,
+                       eho::Growth::CDouble, eho::Growth::CPowerOfTwo<>,
+                       eho::Growth::CPageGranular<eho::Growth::CAmortized>) {
+        eho::CList<std::string, t_tPolicy> lst{};
+        std::vector<std::string> vecObjects{};
+        constexpr size_t uNumItems = 1000;
+
+        size_t uReallocations = 0;
+        for (size_t i = 0; i < uNumItems; ++i) {
+            auto Value = GetRandom<std::string>();
+            size_t uCapacity = lst.capacity();
+            lst.insert(Value);
+            vecObjects.push_back(Value);
+            uReallocations += uCapacity != lst.capacity() ? 1 : 0;
+            CHECK(lst.capacity() >= lst.size());
+        }
+        CHECK(std::ranges::equal(lst, vecObjects));
+        if constexpr (!std::is_same_v<t_tPolicy, eho::Growth::CExact<>>) {
+            CHECK(uReallocations < 50);
+        }
+
+        SUBCASE("Pops do not reallocate until the shrink threshold") {
+            size_t uCapacity = lst.capacity();
+            for (size_t i = 0; i < 10; ++i) {
+                CHECK(*lst.pop() == vecObjects.back());
+                vecObjects.pop_back();
+                lst.insert(vecObjects.back());
+                vecObjects.push_back(vecObjects.back());
+                CHECK(*lst.pop() == vecObjects.back());
+                vecObjects.pop_back();
+            }
+            CHECK(lst.capacity() == uCapacity);
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            while (lst.size() > uCapacity / 4) {
+                CHECK(*lst.pop(0) == vecObjects.front());
+                vecObjects.erase(vecObjects.begin());
+            }
+            CHECK(lst.capacity() < uCapacity);
+            CHECK(lst.capacity() >= lst.size());
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+
+        SUBCASE("Resize is exact") {
+            lst.resize(uNumItems * 2);
+            CHECK(lst.capacity() == uNumItems * 2);
+            CHECK(lst.size() == uNumItems);
+
+            lst.resize(10);
+            CHECK(lst.capacity() == 10);
+            CHECK(lst.size() == 10);
+            vecObjects.resize(10);
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Linked list", t_tTestType, uint32_t, DefaultConstructor, NonDefaultConstructor, std::string) {
+        eho::CListLinked<t_tTestType> lst{};
+        std::vector<t_tTestType> vecObjects{};
+        CHECK(lst.size() == 0);
+        CHECK(lst.begin() == lst.end());
+
+        auto CheckEqual = [&]() {
+            REQUIRE(lst.size() == vecObjects.size());
+            for (size_t i = 0; i < vecObjects.size(); ++i) {
+                CHECK(lst.at(i) == vecObjects[i]);
+            }
+            CHECK(std::ranges::equal(lst, vecObjects));
+            CHECK(std::ranges::equal(std::ranges::reverse_view(lst), std::ranges::reverse_view(vecObjects)));
+        };
+
+        SUBCASE("Begin insertions") {
+            for (size_t i = 0; i < 100; ++i) {
+                auto Value = GetRandom<t_tTestType>();
+                vecObjects.insert(vecObjects.begin(), Value);
+                lst.insert(0, Value);
+            }
+            CheckEqual();
+        }
+
+        SUBCASE("End insertions") {
+            for (size_t i = 0; i < 100; ++i) {
+                auto Value = GetRandom<t_tTestType>();
+                vecObjects.push_back(Value);
+                lst.insert(Value);
+            }
+            CHECK(lst.capacity() >= lst.size());
+            CheckEqual();
+        }
+
+        SUBCASE("Random pos insertion and removal") {
+            constexpr size_t uNumOperations = 1000;
+            for (size_t i = 0; i < uNumOperations; ++i) {
+                size_t uIndex = Generator() % (vecObjects.size() + 1);
+                auto Value = GetRandom<t_tTestType>();
+                vecObjects.insert(vecObjects.begin() + uIndex, Value);
+                lst.insert(uIndex, Value);
+            }
+            CheckEqual();
+
+            for (size_t i = 0; i < uNumOperations / 2; ++i) {
+                size_t uIndex = Generator() % vecObjects.size();
+                auto Popped = lst.pop(uIndex);
+                REQUIRE(Popped.has_value());
+                CHECK(*Popped == vecObjects[uIndex]);
+                vecObjects.erase(vecObjects.begin() + uIndex);
+            }
+            CheckEqual();
+
+            while (!vecObjects.empty()) {
+                CHECK(*lst.pop() == vecObjects.back());
+                vecObjects.pop_back();
+            }
+            CHECK_FALSE(lst.pop().has_value());
+            CheckEqual();
+        }
+
+        SUBCASE("Range insertion") {
+            for (size_t i = 0; i < 20; ++i) {
+                std::vector<t_tTestType> vecRange(Generator() % 40, GetRandom<t_tTestType>());
+                size_t uIndex = Generator() % (vecObjects.size() + 1);
+                lst.insert(uIndex, vecRange.begin(), vecRange.end());
+                vecObjects.insert(vecObjects.begin() + uIndex, vecRange.begin(), vecRange.end());
+            }
+            std::vector<t_tTestType> vecCopy{vecObjects};
+            lst.append_range(vecCopy);
+            vecObjects.insert(vecObjects.end(), vecCopy.begin(), vecCopy.end());
+            CheckEqual();
+        }
+
+        SUBCASE("Batched removal") {
+            for (size_t i = 0; i < 1000; ++i) {
+                auto Value = GetRandom<t_tTestType>();
+                vecObjects.push_back(Value);
+                lst.insert(Value);
+            }
+
+            for (size_t i = 0; i < 20; ++i) {
+                size_t uFirst = Generator() % vecObjects.size();
+                size_t uLast = uFirst + Generator() % std::min<size_t>(60, vecObjects.size() - uFirst + 1);
+                lst.erase(uFirst, uLast);
+                vecObjects.erase(vecObjects.begin() + uFirst, vecObjects.begin() + uLast);
+            }
+            CheckEqual();
+
+            std::vector<bool> vecDrop{};
+            for (size_t i = 0; i < vecObjects.size(); ++i) {
+                vecDrop.push_back(Generator() % 10 < 3);
+            }
+            size_t uIndex = 0;
+            size_t uDropped = lst.erase_if([&](const t_tTestType &) { return vecDrop[uIndex++]; });
+            uIndex = 0;
+            CHECK(std::erase_if(vecObjects, [&](const t_tTestType &) { return vecDrop[uIndex++]; }) == uDropped);
+            CheckEqual();
+
+            for (size_t i = 0; i < 100; ++i) {
+                size_t uRemove = Generator() % vecObjects.size();
+                CHECK(*lst.swap_remove(uRemove) == vecObjects[uRemove]);
+                vecObjects[uRemove] = vecObjects.back();
+                vecObjects.pop_back();
+            }
+            CheckEqual();
+
+            lst.erase(0, lst.size());
+            vecObjects.clear();
+            CheckEqual();
+        }
+
+        SUBCASE("Resize and clear") {
+            for (size_t i = 0; i < 100; ++i) {
+                auto Value = GetRandom<t_tTestType>();
+                vecObjects.push_back(Value);
+                lst.insert(Value);
+            }
+
+            lst.resize(40);
+            vecObjects.resize(40, vecObjects.front());
+            CHECK(lst.capacity() >= 40);
+            CheckEqual();
+
+            lst.resize(500);
+            CHECK(lst.capacity() >= 500);
+            CheckEqual();
+
+            lst.clear();
+            vecObjects.clear();
+            CHECK(lst.empty());
+            CHECK(lst.capacity() == 0);
+            CheckEqual();
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Small list", t_tTestType, uint32_t, RelocatableHandle, std::string) {
+        eho::CListSmall<t_tTestType, 8, eho::Growth::CAmortized> lst{};
+        std::vector<t_tTestType> vecObjects{};
+
+        auto Random = []() {
+            if constexpr (std::is_same_v<t_tTestType, RelocatableHandle>) {
+                return RelocatableHandle{static_cast<uint32_t>(Generator())};
+            } else {
+                return GetRandom<t_tTestType>();
+            }
+        };
+        auto IsInline = [](const auto &List) {
+            auto *pObject = reinterpret_cast<const std::byte *>(&List);
+            auto *pData = reinterpret_cast<const std::byte *>(List.data());
+            return pData >= pObject && pData < pObject + sizeof(List);
+        };
+
+        CHECK(lst.capacity() == 8);
+        CHECK(IsInline(lst));
+
+        SUBCASE("Inline until full") {
+            for (size_t i = 0; i < 8; ++i) {
+                auto Value = Random();
+                vecObjects.insert(vecObjects.begin(), Value);
+                lst.insert(0, Value);
+                CHECK(IsInline(lst));
+            }
+            CHECK(lst.capacity() == 8);
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            // Spills to the heap
+            auto Value = Random();
+            vecObjects.push_back(Value);
+            lst.emplace_back(Value);
+            CHECK_FALSE(IsInline(lst));
+            CHECK(lst.capacity() == 12);
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+
+        SUBCASE("Spill and shrink back") {
+            for (size_t i = 0; i < 100; ++i) {
+                size_t uIndex = Generator() % (vecObjects.size() + 1);
+                auto Value = Random();
+                vecObjects.insert(vecObjects.begin() + uIndex, Value);
+                lst.insert(uIndex, Value);
+            }
+            CHECK_FALSE(IsInline(lst));
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            while (vecObjects.size() > 2) {
+                size_t uIndex = Generator() % vecObjects.size();
+                CHECK(*lst.pop(uIndex) == vecObjects[uIndex]);
+                vecObjects.erase(vecObjects.begin() + uIndex);
+            }
+            CHECK(IsInline(lst));
+            CHECK(lst.capacity() == 8);
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            lst.resize(50);
+            CHECK_FALSE(IsInline(lst));
+            lst.resize(4);
+            CHECK(IsInline(lst));
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+
+        SUBCASE("Move") {
+            for (size_t i = 0; i < 5; ++i) {
+                vecObjects.push_back(Random());
+            }
+            lst.append_range(vecObjects);
+
+            // Inline elements are moved one by one
+            decltype(lst) lstInline{std::move(lst)};
+            CHECK(IsInline(lstInline));
+            CHECK(lst.empty());
+            CHECK(std::ranges::equal(lstInline, vecObjects));
+
+            for (size_t i = 0; i < 20; ++i) {
+                vecObjects.push_back(Random());
+            }
+            lstInline.append_range(std::ranges::subrange(vecObjects.begin() + 5, vecObjects.end()));
+
+            // The heap allocation is taken as is
+            const t_tTestType *pData = lstInline.data();
+            decltype(lst) lstHeap{};
+            lstHeap.insert(Random());
+            lstHeap = std::move(lstInline);
+            CHECK(lstHeap.data() == pData);
+            CHECK(lstInline.empty());
+            CHECK(IsInline(lstInline));
+            CHECK(std::ranges::equal(lstHeap, vecObjects));
+
+            lst = std::move(lstHeap);
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+
+        SUBCASE("Erase") {
+            for (size_t i = 0; i < 30; ++i) {
+                vecObjects.push_back(Random());
+            }
+            lst.append_range(vecObjects);
+
+            lst.erase(2, 27);
+            vecObjects.erase(vecObjects.begin() + 2, vecObjects.begin() + 27);
+            CHECK(IsInline(lst));
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            lst.clear();
+            CHECK(lst.empty());
+            CHECK(lst.capacity() == 8);
+        }
+    }
+
+    constexpr uint32_t InplaceListSum() {
+        eho::CListInplace<uint32_t, 8> lst{};
+        for (uint32_t i = 0; i < 6; ++i) {
+            lst.insert(0, i);
+        }
+        lst.insert(3, {10, 20});
+        lst.erase(0, 1);
+        lst.erase_if([](uint32_t i) { return i == 10; });
+        lst.pop(0);
+        return std::accumulate(lst.begin(), lst.end(), 0u) + 100 * static_cast<uint32_t>(lst.size());
+    }
+
+    TEST_CASE_TEMPLATE("Inplace list", t_tTestType, uint32_t, NonDefaultConstructor, std::string) {
+        static_assert(InplaceListSum() == 20 + 3 + 2 + 1 + 0 + 500);
+
+        eho::CListInplace<t_tTestType, 16> lst{};
+        std::vector<t_tTestType> vecObjects{};
+        CHECK(lst.empty());
+        CHECK(lst.capacity() == 16);
+
+        auto CheckEqual = [&]() {
+            REQUIRE(lst.size() == vecObjects.size());
+            CHECK(std::ranges::equal(lst, vecObjects));
+        };
+
+        SUBCASE("Insertion and removal") {
+            for (size_t i = 0; i < 16; ++i) {
+                size_t uIndex = Generator() % (vecObjects.size() + 1);
+                auto Value = GetRandom<t_tTestType>();
+                vecObjects.insert(vecObjects.begin() + uIndex, Value);
+                lst.insert(uIndex, Value);
+            }
+            CheckEqual();
+            CHECK(lst.capacity() == 16);
+
+            CHECK_THROWS_AS(lst.insert(GetRandom<t_tTestType>()), std::length_error);
+            CHECK_THROWS_AS(lst.emplace_back(GetRandom<t_tTestType>()), std::length_error);
+            CheckEqual();
+
+            lst.erase(3, 6);
+            vecObjects.erase(vecObjects.begin() + 3, vecObjects.begin() + 6);
+            CheckEqual();
+
+            CHECK(*lst.swap_remove(0) == vecObjects.front());
+            vecObjects.front() = vecObjects.back();
+            vecObjects.pop_back();
+            CheckEqual();
+
+            while (!vecObjects.empty()) {
+                size_t uIndex = Generator() % vecObjects.size();
+                CHECK(*lst.pop(uIndex) == vecObjects[uIndex]);
+                vecObjects.erase(vecObjects.begin() + uIndex);
+            }
+            CheckEqual();
+            CHECK_FALSE(lst.pop().has_value());
+        }
+
+        SUBCASE("Range insertion") {
+            auto vecItems = GetObjects<t_tTestType>();
+            lst.append_range(vecItems);
+            lst.insert(1, vecItems.begin(), vecItems.end());
+            vecObjects.insert(vecObjects.end(), vecItems.begin(), vecItems.end());
+            vecObjects.insert(vecObjects.begin() + 1, vecItems.begin(), vecItems.end());
+            CheckEqual();
+
+            CHECK_THROWS_AS(lst.append_range(std::vector<t_tTestType>(10, vecItems[0])), std::length_error);
+            CheckEqual();
+        }
+
+        SUBCASE("Resize, clear and move") {
+            lst.append_range(GetObjects<t_tTestType>());
+            vecObjects.assign(lst.begin(), lst.end());
+
+            decltype(lst) lstMoved{std::move(lst)};
+            CHECK(lst.empty());
+            CHECK(std::ranges::equal(lstMoved, vecObjects));
+
+            lstMoved.resize(2);
+            vecObjects.resize(2, vecObjects[0]);
+            CHECK(lstMoved.capacity() == 16);
+            CHECK(std::ranges::equal(lstMoved, vecObjects));
+            CHECK_THROWS_AS(lstMoved.resize(17), std::length_error);
+
+            lst = std::move(lstMoved);
+            CheckEqual();
+            lst.clear();
+            CHECK(lst.empty());
+        }
+    }
+
+    TEST_CASE("Inplace list - Lazy construction") {
+        eho::CListInplace<CopyCounter, 64> lst{};
+        CopyCounter::Reset();
+        for (uint32_t i = 0; i < 64; ++i) {
+            lst.emplace_back(i);
+        }
+        CHECK(CopyCounter::s_uCopies == 0);
+        CHECK(CopyCounter::s_uMoves == 0);
+        CHECK(lst[63].Get() == 63);
+    }
+
+    TEST_CASE_TEMPLATE("Dynamic list - Polymorphic allocator", t_tList, eho::pmr::CList<std::pmr::string>,
+                       eho::pmr::CList<std::pmr::string, eho::Growth::CAmortized>,
+                       eho::pmr::CListLinked<std::pmr::string>, eho::pmr::CListSmall<std::pmr::string, 4>) {
+        CountingResource Resource{};
+        std::vector<std::pmr::string> vecObjects{};
+        {
+            t_tList lst{&Resource};
+            CHECK(lst.get_allocator().resource() == &Resource);
+
+            for (size_t i = 0; i < 200; ++i) {
+                size_t uIndex = Generator() % (vecObjects.size() + 1);
+                // Long enough to not fit the small string buffer
+                std::pmr::string strValue{std::to_string(Generator()) + "_____________________________"};
+                vecObjects.insert(vecObjects.begin() + uIndex, strValue);
+                if (i % 2 == 0) {
+                    lst.insert(uIndex, std::pmr::string{strValue});
+                } else {
+                    lst.emplace(uIndex, strValue);
+                }
+            }
+            CHECK(std::ranges::equal(lst, vecObjects));
+            CHECK(Resource.m_uAllocations > 0);
+            // The elements are built with the list's allocator
+            CHECK(std::ranges::all_of(lst, [&](const std::pmr::string &str) {
+                return str.get_allocator().resource() == &Resource;
+            }));
+
+            SUBCASE("Move to the same resource") {
+                size_t uAllocations = Resource.m_uAllocations;
+                t_tList lstOther{&Resource};
+                lstOther = std::move(lst);
+                CHECK(Resource.m_uAllocations == uAllocations);
+                CHECK(lst.empty());
+                CHECK(std::ranges::equal(lstOther, vecObjects));
+            }
+
+            SUBCASE("Move to another resource") {
+                CountingResource OtherResource{};
+                t_tList lstOther{&OtherResource};
+                lstOther = std::move(lst);
+                CHECK(lstOther.get_allocator().resource() == &OtherResource);
+                CHECK(std::ranges::equal(lstOther, vecObjects));
+                CHECK(std::ranges::all_of(lstOther, [&](const std::pmr::string &str) {
+                    return str.get_allocator().resource() == &OtherResource;
+                }));
+                lstOther.clear();
+                CHECK(OtherResource.m_uBytesInUse == 0);
+            }
+
+            while (!vecObjects.empty()) {
+                vecObjects.pop_back();
+                lst.pop();
+            }
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+        CHECK(Resource.m_uBytesInUse == 0);
+    }
+
+    TEST_CASE("Dynamic list - Monotonic arena") {
+        std::array<std::byte, 1 << 16> arBuffer{};
+        std::pmr::monotonic_buffer_resource Arena{arBuffer.data(), arBuffer.size(), std::pmr::null_memory_resource()};
+
+        eho::pmr::CList<uint32_t, eho::Growth::CDouble> lst{&Arena};
+        eho::pmr::CListLinked<uint32_t> lstLinked{&Arena};
+        for (uint32_t i = 0; i < 1000; ++i) {
+            lst.insert(i);
+            lstLinked.insert(0, i);
+        }
+        CHECK(lst.size() == 1000);
+        CHECK(lst[999] == 999);
+        CHECK(lstLinked[999] == 0);
+        CHECK(reinterpret_cast<const std::byte *>(lst.data()) >= arBuffer.data());
+        CHECK(reinterpret_cast<const std::byte *>(lst.data()) < arBuffer.data() + arBuffer.size());
+    }
+
+    TEST_CASE("Dynamic list - Table of lists") {
+        static_assert(eho::is_trivially_relocatable_v<eho::CList<uint32_t>>);
+        static_assert(!eho::is_trivially_relocatable_v<eho::CListSmall<uint32_t, 4>>);
+
+        eho::CList<eho::CList<uint32_t>, eho::Growth::CAmortized> lstTable{};
+        std::vector<std::vector<uint32_t>> vecTable{};
+        for (uint32_t i = 0; i < 300; ++i) {
+            size_t uIndex = Generator() % (vecTable.size() + 1);
+            vecTable.emplace(vecTable.begin() + uIndex);
+            auto &lst = lstTable.emplace(uIndex);
+            for (uint32_t j = 0; j < i % 7; ++j) {
+                vecTable[uIndex].push_back(i + j);
+                lst.insert(i + j);
+            }
+        }
+
+        while (!vecTable.empty()) {
+            size_t uIndex = Generator() % vecTable.size();
+            auto lst = lstTable.pop(uIndex);
+            REQUIRE(lst.has_value());
+            CHECK(std::ranges::equal(*lst, vecTable[uIndex]));
+            vecTable.erase(vecTable.begin() + uIndex);
+            CHECK(lstTable.size() == vecTable.size());
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Huge list", t_tTestType, uint32_t, std::string) {
+        eho::CListHuge<t_tTestType> lst{};
+        std::vector<t_tTestType> vecObjects{};
+        constexpr size_t uNumItems = 1 << 20;
+        for (size_t i = 0; i < uNumItems; ++i) {
+            t_tTestType Value{};
+            if constexpr (std::is_same_v<t_tTestType, std::string>) {
+                Value = std::to_string(i);
+            } else {
+                Value = static_cast<t_tTestType>(i * 7);
+            }
+            vecObjects.push_back(Value);
+            lst.insert(std::move(Value));
+        }
+        CHECK(std::ranges::equal(lst, vecObjects));
+        // Whole huge pages
+        CHECK((lst.capacity() * sizeof(t_tTestType)) % (size_t{2} << 20) == 0);
+        // Mappings are page aligned
+        CHECK(reinterpret_cast<uintptr_t>(lst.data()) % 4096 == 0);
+
+        lst.erase(10, uNumItems - 10);
+        vecObjects.erase(vecObjects.begin() + 10, vecObjects.end() - 10);
+        CHECK(lst.capacity() < uNumItems);
+        CHECK(std::ranges::equal(lst, vecObjects));
+
+        eho::CListHuge<t_tTestType> lstMoved{std::move(lst)};
+        CHECK(lst.empty());
+        CHECK(std::ranges::equal(lstMoved, vecObjects));
+        lst = std::move(lstMoved);
+        lst.insert(0, vecObjects.begin(), vecObjects.end());
+        CHECK(lst.size() == 2 * vecObjects.size());
+    }
+
+    TEST_CASE_TEMPLATE("Aligned list", t_tList, eho::CListAligned<float, 32>, eho::CListAligned<double>,
+                       eho::CListAligned<uint16_t, 64, eho::Growth::CAmortized>,
+                       eho::CListSmall<float, 3, eho::Growth::CExact<>, eho::CAlignedAllocator<float, 32>>) {
+        using Type = std::ranges::range_value_t<t_tList>;
+        constexpr size_t uAlignment = t_tList::alignment();
+        constexpr size_t uBlock = uAlignment / sizeof(Type);
+        auto IsAligned = [](const t_tList &lst) {
+            return reinterpret_cast<uintptr_t>(lst.data()) % uAlignment == 0;
+        };
+
+        t_tList lst{};
+        std::vector<Type> vecObjects{};
+        for (size_t i = 0; i < 100; ++i) {
+            lst.insert(static_cast<Type>(i));
+            vecObjects.push_back(static_cast<Type>(i));
+            CHECK(IsAligned(lst));
+            CHECK(lst.padded_size() % uBlock == 0);
+            CHECK(lst.padded_size() >= lst.size());
+            CHECK(lst.padded_size() < lst.size() + uBlock);
+        }
+        CHECK(std::ranges::equal(lst, vecObjects));
+
+        lst.erase(1, 95);
+        vecObjects.erase(vecObjects.begin() + 1, vecObjects.end() - 5);
+        CHECK(IsAligned(lst));
+        CHECK(std::ranges::equal(lst, vecObjects));
+        CHECK(lst.padded_size() == uBlock);
+
+        lst.insert(2, vecObjects.begin(), vecObjects.end());
+        vecObjects.insert(vecObjects.begin() + 2, vecObjects.begin(), vecObjects.end());
+        CHECK(IsAligned(lst));
+        CHECK(std::ranges::equal(lst, vecObjects));
+
+        t_tList lstMoved{std::move(lst)};
+        CHECK(IsAligned(lstMoved));
+        CHECK(std::ranges::equal(lstMoved, vecObjects));
+    }
+
+    TEST_CASE_TEMPLATE("Segmented list", t_tTestType, uint32_t, RelocatableHandle, std::string) {
+        eho::CListSegmented<t_tTestType, 64> lst{};
+        std::vector<t_tTestType> vecObjects{};
+        auto MakeValue = [](size_t i) {
+            if constexpr (std::is_same_v<t_tTestType, std::string>) {
+                return std::to_string(i);
+            } else {
+                return t_tTestType(static_cast<uint32_t>(i));
+            }
+        };
+
+        std::vector<const t_tTestType *> vecPointers{};
+        for (size_t i = 0; i < 1000; ++i) {
+            lst.insert(MakeValue(i));
+            vecObjects.push_back(MakeValue(i));
+            vecPointers.push_back(&lst[i]);
+        }
+        CHECK(std::ranges::equal(lst, vecObjects));
+        CHECK(lst.capacity() >= lst.size());
+
+        SUBCASE("Pointer stability") {
+            // Growing and removing from the end never moves the elements
+            for (size_t i = 1000; i < 5000; ++i) {
+                lst.emplace_back(MakeValue(i));
+            }
+            lst.erase(2000, 5000);
+            for (size_t i = 0; i < vecPointers.size(); ++i) {
+                CHECK(vecPointers[i] == &lst[i]);
+                CHECK(*vecPointers[i] == vecObjects[i]);
+            }
+        }
+
+        SUBCASE("Insert and remove") {
+            std::mt19937 Generator{42};
+            for (size_t i = 0; i < 300; ++i) {
+                size_t uIndex = Generator() % (vecObjects.size() + 1);
+                lst.insert(uIndex, MakeValue(i));
+                vecObjects.insert(vecObjects.begin() + static_cast<std::ptrdiff_t>(uIndex), MakeValue(i));
+
+                uIndex = Generator() % vecObjects.size();
+                auto Item = lst.pop(uIndex);
+                REQUIRE(Item.has_value());
+                CHECK(*Item == vecObjects[uIndex]);
+                vecObjects.erase(vecObjects.begin() + static_cast<std::ptrdiff_t>(uIndex));
+            }
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            std::vector<t_tTestType> vecHead{vecObjects.begin(), vecObjects.begin() + 100};
+            lst.insert(10, vecHead.begin(), vecHead.end());
+            vecObjects.insert(vecObjects.begin() + 10, vecHead.begin(), vecHead.end());
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            lst.erase(5, 600);
+            vecObjects.erase(vecObjects.begin() + 5, vecObjects.begin() + 600);
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            lst.swap_remove(0);
+            vecObjects.front() = std::move(vecObjects.back());
+            vecObjects.pop_back();
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            // The argument references an element moved by the shift
+            lst.insert(0, lst[lst.size() - 1]);
+            vecObjects.insert(vecObjects.begin(), t_tTestType(vecObjects.back()));
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            size_t uRemoved = lst.erase_if([&](const t_tTestType &Item) { return Item == vecObjects[3]; });
+            CHECK(uRemoved == static_cast<size_t>(std::erase(vecObjects, t_tTestType(vecObjects[3]))));
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+
+        SUBCASE("Algorithms") {
+            if constexpr (std::totally_ordered<t_tTestType>) {
+                std::ranges::sort(lst, std::greater{});
+                std::ranges::sort(vecObjects, std::greater{});
+                CHECK(std::ranges::equal(lst, vecObjects));
+                CHECK(std::ranges::binary_search(lst, vecObjects[500], std::greater{}));
+            }
+            CHECK(std::ranges::find(lst, vecObjects[700]) - lst.begin() == 700);
+            CHECK(std::ranges::equal(lst | std::views::reverse, vecObjects | std::views::reverse));
+        }
+
+        SUBCASE("Capacity") {
+            lst.clear();
+            CHECK(lst.empty());
+            CHECK(lst.capacity() == 0);
+            lst.resize(100);
+            CHECK(lst.capacity() >= 100);
+            CHECK(lst.empty());
+        }
+
+        SUBCASE("Move") {
+            eho::CListSegmented<t_tTestType, 64> lstMoved{std::move(lst)};
+            CHECK(lst.empty());
+            CHECK(std::ranges::equal(lstMoved, vecObjects));
+            CHECK(&lstMoved[0] == vecPointers[0]);
+            lst = std::move(lstMoved);
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Gap list", t_tTestType, uint32_t, RelocatableHandle, std::string) {
+        auto MakeValue = [](size_t i) {
+            if constexpr (std::is_same_v<t_tTestType, std::string>) {
+                return std::to_string(i);
+            } else {
+                return t_tTestType(static_cast<uint32_t>(i));
+            }
+        };
+
+        eho::CListGap<t_tTestType> lst{};
+        std::vector<t_tTestType> vecObjects{};
+        for (size_t i = 0; i < 100; ++i) {
+            lst.insert(MakeValue(i));
+            vecObjects.push_back(MakeValue(i));
+        }
+        CHECK(std::ranges::equal(lst, vecObjects));
+        // Checked like the other lists, also through the view
+        CHECK_THROWS_AS(lst[100], std::out_of_range);
+        const eho::IListView<t_tTestType, typename eho::CListGap<t_tTestType>::ConstIterator> &View = lst;
+        CHECK(View[99] == vecObjects[99]);
+        CHECK_THROWS_AS(View[100], std::out_of_range);
+
+        SUBCASE("Cursor edits") {
+            // Typing, deleting and jumping around like an editor
+            std::mt19937 Generator{3};
+            size_t uCursor = 50;
+            for (size_t i = 0; i < 3000; ++i) {
+                uint32_t uAction = Generator() % 10;
+                if (uAction == 0) {
+                    uCursor = Generator() % (vecObjects.size() + 1);
+                } else if (uAction < 7 || vecObjects.empty()) {
+                    lst.insert(uCursor, MakeValue(i));
+                    vecObjects.insert(vecObjects.begin() + static_cast<std::ptrdiff_t>(uCursor), MakeValue(i));
+                    ++uCursor;
+                    CHECK(lst.gap() == uCursor);
+                } else if (uCursor > 0) {
+                    --uCursor;
+                    auto Item = lst.pop(uCursor);
+                    REQUIRE(Item.has_value());
+                    CHECK(*Item == vecObjects[uCursor]);
+                    vecObjects.erase(vecObjects.begin() + static_cast<std::ptrdiff_t>(uCursor));
+                }
+                REQUIRE(lst.size() == vecObjects.size());
+            }
+            CHECK(std::ranges::equal(lst, vecObjects));
+            for (size_t i = 0; i < vecObjects.size(); i += 17) {
+                CHECK(lst[i] == vecObjects[i]);
+                CHECK(lst.at(i) == vecObjects[i]);
+            }
+            CHECK_THROWS_AS(lst.at(vecObjects.size()), std::out_of_range);
+        }
+
+        SUBCASE("Ranges") {
+            std::vector<t_tTestType> vecPaste{};
+            for (size_t i = 0; i < 300; ++i) {
+                vecPaste.push_back(MakeValue(1000 + i));
+            }
+            lst.insert(30, vecPaste.begin(), vecPaste.end());
+            vecObjects.insert(vecObjects.begin() + 30, vecPaste.begin(), vecPaste.end());
+            CHECK(lst.gap() == 330);
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            lst.erase(10, 250);
+            vecObjects.erase(vecObjects.begin() + 10, vecObjects.begin() + 250);
+            CHECK(lst.gap() == 10);
+            CHECK(std::ranges::equal(lst, vecObjects));
+            CHECK(std::ranges::equal(lst | std::views::reverse, vecObjects | std::views::reverse));
+
+            // The argument references an element moved with the gap
+            lst.insert(0, lst[lst.size() - 1]);
+            vecObjects.insert(vecObjects.begin(), t_tTestType(vecObjects.back()));
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            if constexpr (std::totally_ordered<t_tTestType>) {
+                std::ranges::sort(lst);
+                std::ranges::sort(vecObjects);
+                CHECK(std::ranges::equal(lst, vecObjects));
+            }
+        }
+
+        SUBCASE("List view") {
+            lst.insert(40, MakeValue(7));
+            vecObjects.insert(vecObjects.begin() + 40, MakeValue(7));
+            const eho::IListView<t_tTestType, typename eho::CListGap<t_tTestType>::ConstIterator> &View = lst;
+            CHECK(View.size() == vecObjects.size());
+            CHECK(View[41] == vecObjects[41]);
+            CHECK(std::ranges::equal(View.begin(), View.end(), vecObjects.begin(), vecObjects.end()));
+        }
+
+        SUBCASE("Capacity") {
+            while (lst.pop(lst.size() / 2).has_value()) {}
+            CHECK(lst.empty());
+            CHECK(lst.capacity() < 100);
+            lst.resize(64);
+            CHECK(lst.capacity() == 64);
+            lst.insert(MakeValue(1));
+            lst.clear();
+            CHECK(lst.empty());
+            CHECK(lst.capacity() == 0);
+        }
+
+        SUBCASE("Move") {
+            lst.insert(20, MakeValue(5));
+            vecObjects.insert(vecObjects.begin() + 20, MakeValue(5));
+            eho::CListGap<t_tTestType> lstMoved{std::move(lst)};
+            CHECK(lst.empty());
+            CHECK(std::ranges::equal(lstMoved, vecObjects));
+            lst = std::move(lstMoved);
+            CHECK(std::ranges::equal(lst, vecObjects));
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Ring list", t_tList, eho::CListRing<uint32_t>, eho::CListRing<std::string>,
+                       eho::CListRing<RelocatableHandle, eho::Growth::CExact<>>, eho::CListRingStatic<std::string, 64>) {
+        using Type = std::ranges::range_value_t<t_tList>;
+        auto MakeValue = [](size_t i) {
+            if constexpr (std::is_same_v<Type, std::string>) {
+                return std::to_string(i);
+            } else {
+                return Type(static_cast<uint32_t>(i));
+            }
+        };
+        auto Joined = [](const t_tList &lst) {
+            std::vector<Type> vecItems{};
+            for (auto Span: lst.as_spans()) {
+                vecItems.insert(vecItems.end(), Span.begin(), Span.end());
+            }
+            return vecItems;
+        };
+
+        t_tList lst{};
+        std::deque<Type> deqObjects{};
+        CHECK(lst.empty());
+        CHECK_FALSE(lst.pop_front().has_value());
+        CHECK_FALSE(lst.pop_back().has_value());
+        CHECK_THROWS_AS(lst.front(), std::out_of_range);
+        CHECK_THROWS_AS(lst[0], std::out_of_range);
+
+        SUBCASE("Both ends") {
+            std::mt19937 Generator{7};
+            for (size_t i = 0; i < 5000; ++i) {
+                switch (Generator() % 4) {
+                    case 0:
+                        if (deqObjects.size() < 64) {
+                            lst.push_back(MakeValue(i));
+                            deqObjects.push_back(MakeValue(i));
+                        }
+                        break;
+                    case 1:
+                        if (deqObjects.size() < 64) {
+                            lst.emplace_front(MakeValue(i));
+                            deqObjects.push_front(MakeValue(i));
+                        }
+                        break;
+                    case 2:
+                        if (!deqObjects.empty()) {
+                            CHECK(lst.pop_front() == deqObjects.front());
+                            deqObjects.pop_front();
+                        }
+                        break;
+                    default:
+                        if (!deqObjects.empty()) {
+                            CHECK(lst.pop_back() == deqObjects.back());
+                            deqObjects.pop_back();
+                        }
+                        break;
+                }
+                REQUIRE(lst.size() == deqObjects.size());
+            }
+            CHECK(std::ranges::equal(lst, deqObjects));
+            CHECK(std::ranges::equal(Joined(lst), deqObjects));
+            CHECK(std::ranges::equal(lst | std::views::reverse, deqObjects | std::views::reverse));
+            if (!deqObjects.empty()) {
+                CHECK(lst.front() == deqObjects.front());
+                CHECK(lst.back() == deqObjects.back());
+                CHECK(lst.at(deqObjects.size() / 2) == deqObjects[deqObjects.size() / 2]);
+            }
+        }
+
+        SUBCASE("Wrapped halves") {
+            for (size_t i = 0; i < 40; ++i) {
+                lst.push_back(MakeValue(i));
+                deqObjects.push_back(MakeValue(i));
+            }
+            for (size_t i = 0; i < 30; ++i) {
+                lst.pop_front();
+                deqObjects.pop_front();
+            }
+            for (size_t i = 40; i < 60; ++i) {
+                lst.push_back(MakeValue(i));
+                deqObjects.push_back(MakeValue(i));
+            }
+            auto arSpans = std::as_const(lst).as_spans();
+            CHECK(arSpans[0].size() + arSpans[1].size() == lst.size());
+            CHECK(std::ranges::equal(Joined(lst), deqObjects));
+            const eho::IListView<Type, typename t_tList::ConstIterator> &View = lst;
+            CHECK(std::ranges::equal(View, deqObjects));
+            CHECK(View[5] == deqObjects[5]);
+            CHECK_THROWS_AS(View[lst.size()], std::out_of_range);
+        }
+
+        SUBCASE("Capacity") {
+            for (size_t i = 0; i < 64; ++i) {
+                lst.push_front(MakeValue(i));
+                deqObjects.push_front(MakeValue(i));
+            }
+            if constexpr (std::is_same_v<t_tList, eho::CListRingStatic<std::string, 64>>) {
+                CHECK(lst.capacity() == 64);
+                CHECK_THROWS_AS(lst.push_back(MakeValue(0)), std::length_error);
+                CHECK_THROWS_AS(lst.push_front(MakeValue(0)), std::length_error);
+            } else {
+                lst.push_back(MakeValue(64));
+                deqObjects.push_back(MakeValue(64));
+                CHECK(lst.capacity() >= 65);
+                lst.push_front(lst.back());
+                deqObjects.push_front(deqObjects.back());
+            }
+            CHECK(std::ranges::equal(lst, deqObjects));
+            lst.clear();
+            CHECK(lst.empty());
+        }
+
+        SUBCASE("Move") {
+            for (size_t i = 0; i < 50; ++i) {
+                lst.push_front(MakeValue(i));
+                deqObjects.push_front(MakeValue(i));
+            }
+            t_tList lstMoved{std::move(lst)};
+            CHECK(lst.empty());
+            CHECK(std::ranges::equal(lstMoved, deqObjects));
+            lst = std::move(lstMoved);
+            CHECK(lstMoved.empty());
+            CHECK(std::ranges::equal(lst, deqObjects));
+
+            // The target's head is not at the start of its buffer
+            t_tList lstTarget{};
+            for (size_t i = 0; i < 4; ++i) {
+                lstTarget.push_back(MakeValue(i));
+            }
+            lstTarget.pop_front();
+            lstTarget.pop_front();
+            lstTarget.push_front(MakeValue(100));
+            lstTarget = std::move(lst);
+            CHECK(lst.empty());
+            CHECK(std::ranges::equal(lstTarget, deqObjects));
+        }
+    }
+
+    TEST_CASE("Struct of arrays list") {
+        eho::CListSoA<uint32_t, std::string, double> lst{};
+        std::vector<std::tuple<uint32_t, std::string, double>> vecObjects{};
+        for (uint32_t i = 0; i < 100; ++i) {
+            lst.emplace_back(i, std::to_string(i), i * 0.5);
+            vecObjects.emplace_back(i, std::to_string(i), i * 0.5);
+        }
+        CHECK(lst.size() == 100);
+        CHECK(std::ranges::equal(lst, vecObjects));
+
+        SUBCASE("Columns") {
+            auto spanIds = lst.column<0>();
+            CHECK(spanIds.size() == lst.size());
+            CHECK(std::accumulate(spanIds.begin(), spanIds.end(), 0u) == 4950);
+            for (double &Value: lst.column<2>()) {
+                Value *= 2;
+            }
+            CHECK(lst.at(10) == std::tuple<uint32_t, std::string, double>{10, "10", 10.0});
+
+            const auto &lstConst = lst;
+            CHECK(std::ranges::equal(lstConst.column<1>(), vecObjects | std::views::elements<1>));
+            CHECK_THROWS_AS(lstConst.at(100), std::out_of_range);
+        }
+
+        SUBCASE("Proxy references") {
+            auto [uId, strName, fValue] = lst[3];
+            uId = 300;
+            strName = "three";
+            CHECK(lst[3] == std::tuple<uint32_t, std::string, double>{300, "three", 1.5});
+
+            lst[4] = lst[5];
+            CHECK(lst[4] == vecObjects[5]);
+            lst[6] = std::tuple<uint32_t, std::string, double>{6, "six", 6.0};
+            CHECK(std::get<1>(lst[6]) == "six");
+
+            std::tuple<uint32_t, std::string, double> Record = lst[7];
+            CHECK(Record == vecObjects[7]);
+        }
+
+        SUBCASE("Algorithms") {
+            std::ranges::reverse(lst);
+            std::ranges::reverse(vecObjects);
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            std::ranges::sort(lst, std::less{}, [](const auto &Record) { return std::get<2>(Record); });
+            std::ranges::sort(vecObjects, std::less{}, [](const auto &Record) { return std::get<2>(Record); });
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            std::ranges::sort(lst.begin(), lst.end(), std::greater{});
+            std::ranges::sort(vecObjects, std::greater{});
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            auto it = std::ranges::find(lst, 50u, [](const auto &Record) { return std::get<0>(Record); });
+            CHECK(it - lst.begin() == 49);
+        }
+
+        SUBCASE("Removal") {
+            auto Record = lst.pop(0);
+            vecObjects.erase(vecObjects.begin());
+            REQUIRE(Record.has_value());
+            CHECK(std::get<1>(*Record) == "0");
+
+            lst.erase(10, 60);
+            vecObjects.erase(vecObjects.begin() + 10, vecObjects.begin() + 60);
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            Record = lst.swap_remove(0);
+            CHECK(std::get<0>(*Record) == 1);
+            vecObjects.front() = std::move(vecObjects.back());
+            vecObjects.pop_back();
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            lst.insert(5, {1000, "thousand", 0.0});
+            vecObjects.insert(vecObjects.begin() + 5, {1000, "thousand", 0.0});
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            while (lst.pop().has_value()) {}
+            CHECK(lst.empty());
+            CHECK(lst.column<1>().empty());
+            CHECK_THROWS_AS(lst.emplace(1, 0u, "", 0.0), std::out_of_range);
+        }
+
+        SUBCASE("Move") {
+            auto lstMoved = std::move(lst);
+            CHECK(lst.empty());
+            CHECK(std::ranges::equal(lstMoved, vecObjects));
+        }
+    }
+
+    TEST_CASE("Bit list") {
+        std::mt19937 Generator{42};
+        eho::CList<bool> lst{};
+        std::vector<bool> vecObjects{};
+        for (size_t i = 0; i < 1'000; ++i) {
+            bool bValue = Generator() % 3 == 0;
+            lst.insert(bValue);
+            vecObjects.push_back(bValue);
+        }
+        CHECK(lst.size() == 1'000);
+        CHECK(lst.words().size() == 16);
+        CHECK(std::ranges::equal(lst, vecObjects));
+
+        SUBCASE("Proxy references") {
+            lst[3] = true;
+            lst.at(4) = false;
+            lst[5] = lst[3];
+            vecObjects[3] = true;
+            vecObjects[4] = false;
+            vecObjects[5] = true;
+            lst[6].flip();
+            vecObjects[6].flip();
+            CHECK(std::ranges::equal(lst, vecObjects));
+            CHECK_THROWS_AS(lst.at(1'000), std::out_of_range);
+
+            const auto &lstConst = lst;
+            CHECK(lstConst.at(3));
+            CHECK_THROWS_AS(lstConst.at(1'000), std::out_of_range);
+        }
+
+        SUBCASE("Algorithms") {
+            std::ranges::reverse(lst);
+            std::reverse(vecObjects.begin(), vecObjects.end());
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            std::ranges::sort(lst);
+            CHECK(std::ranges::is_sorted(lst));
+            CHECK(std::ranges::find(lst, true) - lst.begin() == static_cast<std::ptrdiff_t>(lst.find_first()));
+
+            std::ranges::fill(lst.begin() + 10, lst.begin() + 900, true);
+            CHECK(std::ranges::count(lst, true) == static_cast<std::ptrdiff_t>(lst.count()));
+        }
+
+        SUBCASE("Word operations") {
+            CHECK(lst.count() == static_cast<size_t>(std::ranges::count(vecObjects, true)));
+            CHECK(lst.find_first() == static_cast<size_t>(std::ranges::find(vecObjects, true) - vecObjects.begin()));
+            CHECK(lst.find_first(false) == static_cast<size_t>(std::ranges::find(vecObjects, false) - vecObjects.begin()));
+            CHECK(lst.any());
+            CHECK_FALSE(lst.all());
+
+            // The bits past the size must not be counted or found
+            eho::CList<bool> lstOnes{};
+            lstOnes.append_range(std::vector<bool>(130, true));
+            CHECK(lstOnes.all());
+            CHECK(lstOnes.find_first(false) == 130);
+            lstOnes.flip();
+            CHECK(lstOnes.none());
+            CHECK(lstOnes.count() == 0);
+            CHECK(lstOnes.find_first() == 130);
+            lstOnes.flip();
+
+            eho::CList<bool> lstEmpty{};
+            CHECK(lstEmpty.all());
+            CHECK_FALSE(lstEmpty.any());
+            CHECK(lstEmpty.find_first() == 0);
+
+            eho::CList<bool> lstOther{};
+            for (size_t i = 0; i < lst.size(); ++i) {
+                lstOther.insert(i % 7 == 0);
+            }
+            // The lists are move only, the operations are applied to copies
+            auto Check = [&](auto Apply, auto Operation) {
+                eho::CList<bool> lstResult{};
+                lstResult.append_range(lst);
+                Apply(lstResult);
+                REQUIRE(lstResult.size() == lst.size());
+                for (size_t i = 0; i < lst.size(); ++i) {
+                    CHECK(lstResult[i] == Operation(vecObjects[i], i % 7 == 0));
+                }
+                return lstResult;
+            };
+            auto lstAnd = Check([&](auto &lstResult) { lstResult &= lstOther; }, std::bit_and<bool>{});
+            Check([&](auto &lstResult) { lstResult |= lstOther; }, std::bit_or<bool>{});
+            Check([&](auto &lstResult) { lstResult ^= lstOther; }, std::bit_xor<bool>{});
+            auto lstFlipped = Check([](auto &lstResult) { lstResult.flip(); }, [](bool bLeft, bool) { return !bLeft; });
+            lstOther &= lst;
+            CHECK(lstOther == lstAnd);
+            lstFlipped |= lst;
+            CHECK(lstFlipped.all());
+            lstFlipped ^= lstFlipped;
+            CHECK(lstFlipped.none());
+            CHECK_THROWS_AS(lst &= lstOnes, std::invalid_argument);
+        }
+
+        SUBCASE("Insertion and removal") {
+            for (size_t uIndex: {size_t{0}, size_t{63}, size_t{64}, size_t{500}, lst.size()}) {
+                lst.insert(uIndex, true);
+                vecObjects.insert(vecObjects.begin() + static_cast<std::ptrdiff_t>(uIndex), true);
+                lst.insert(uIndex, false);
+                vecObjects.insert(vecObjects.begin() + static_cast<std::ptrdiff_t>(uIndex), false);
+            }
+            CHECK(std::ranges::equal(lst, vecObjects));
+            CHECK_THROWS_AS(lst.insert(lst.size() + 1, true), std::out_of_range);
+
+            CHECK(lst.pop(64) == vecObjects[64]);
+            vecObjects.erase(vecObjects.begin() + 64);
+            CHECK(lst.pop() == vecObjects.back());
+            vecObjects.pop_back();
+            CHECK(std::ranges::equal(lst, vecObjects));
+
+            for (auto [uFirst, uLast]: {std::pair{size_t{3}, size_t{3}}, std::pair{size_t{10}, size_t{75}},
+                                        std::pair{size_t{64}, size_t{128}}, std::pair{size_t{1}, size_t{200}}}) {
+                lst.erase(uFirst, uLast);
+                vecObjects.erase(vecObjects.begin() + static_cast<std::ptrdiff_t>(uFirst),
+                                 vecObjects.begin() + static_cast<std::ptrdiff_t>(uLast));
+                CHECK(std::ranges::equal(lst, vecObjects));
+                CHECK(lst.count() == static_cast<size_t>(std::ranges::count(vecObjects, true)));
+            }
+            CHECK_THROWS_AS(lst.erase(5, lst.size() + 1), std::out_of_range);
+
+            lst.resize(100);
+            vecObjects.resize(100);
+            CHECK(std::ranges::equal(lst, vecObjects));
+            CHECK(lst.capacity() == 128);
+            CHECK(lst.count() == static_cast<size_t>(std::ranges::count(vecObjects, true)));
+
+            while (lst.pop().has_value()) {}
+            CHECK(lst.empty());
+            CHECK(lst.words().empty());
+        }
+
+        SUBCASE("Polymorphic allocator") {
+            std::pmr::monotonic_buffer_resource Arena{};
+            eho::pmr::CList<bool> lstArena{&Arena};
+            lstArena.append_range(vecObjects);
+            CHECK(std::ranges::equal(lstArena, vecObjects));
+            CHECK(lstArena.get_allocator().resource() == &Arena);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Concurrent list", t_tTestType, uint32_t, std::string) {
+        auto MakeValue = [](size_t i) {
+            if constexpr (std::is_same_v<t_tTestType, std::string>) {
+                return std::to_string(i);
+            } else {
+                return static_cast<t_tTestType>(i);
+            }
+        };
+        // Small first segment, so the elements span many segments
+        eho::CListConcurrent<t_tTestType, 64> lst{};
+        CHECK(lst.empty());
+        CHECK_THROWS_AS(lst.at(0), std::out_of_range);
+
+        SUBCASE("Single thread") {
+            std::vector<t_tTestType> vecObjects{};
+            for (size_t i = 0; i < 1000; ++i) {
+                CHECK(lst.emplace_back(MakeValue(i)) == i);
+                vecObjects.push_back(MakeValue(i));
+            }
+            CHECK(lst.size() == 1000);
+            CHECK(lst.claimed() == 1000);
+            CHECK(std::ranges::equal(lst, vecObjects));
+            CHECK(lst.at(999) == vecObjects[999]);
+            CHECK(std::ranges::find(lst, vecObjects[700]) - lst.begin() == 700);
+            CHECK(std::ranges::equal(lst | std::views::reverse, vecObjects | std::views::reverse));
+
+            // Pushes after the snapshot don't change it and never move the elements
+            auto Snapshot = lst.snapshot();
+            const t_tTestType *pFirst = &lst[0];
+            lst.reserve(5000);
+            for (size_t i = 1000; i < 5000; ++i) {
+                lst.push_back(MakeValue(i));
+            }
+            CHECK(Snapshot.size() == 1000);
+            CHECK(std::ranges::equal(Snapshot, vecObjects));
+            CHECK_THROWS_AS(Snapshot.at(1000), std::out_of_range);
+            CHECK(&lst[0] == pFirst);
+            CHECK(lst.size() == 5000);
+            CHECK(lst[4999] == MakeValue(4999));
+        }
+
+        SUBCASE("Many threads") {
+            /**
+             * Each thread pushes its index in the high bits and its sequence in the low bits,
+             * a reader checks every snapshot while they push.
+             */
+            constexpr size_t uNumThreads = 4;
+            constexpr size_t uNumItems = 5'000;
+            std::atomic<bool> bDone{false};
+            bool bConsistent = true;
+            std::thread Reader{[&]() {
+                size_t uLastSize = 0;
+                while (!bDone.load()) {
+                    auto Snapshot = lst.snapshot();
+                    bConsistent &= Snapshot.size() >= uLastSize;
+                    bConsistent &= static_cast<size_t>(std::ranges::distance(Snapshot)) == Snapshot.size();
+                    if constexpr (std::is_same_v<t_tTestType, std::string>) {
+                        // Every published element is fully constructed
+                        bConsistent &= std::ranges::none_of(Snapshot, [](const auto &Item) { return Item.empty(); });
+                    }
+                    uLastSize = Snapshot.size();
+                }
+            }};
+            std::vector<std::thread> vecThreads{};
+            for (size_t uThread = 0; uThread < uNumThreads; ++uThread) {
+                vecThreads.emplace_back([&, uThread]() {
+                    for (size_t i = 0; i < uNumItems; ++i) {
+                        lst.push_back(MakeValue(uThread << 16 | i));
+                    }
+                });
+            }
+            for (auto &Thread: vecThreads) {
+                Thread.join();
+            }
+            bDone = true;
+            Reader.join();
+            CHECK(bConsistent);
+
+            REQUIRE(lst.size() == uNumThreads * uNumItems);
+            std::vector<t_tTestType> vecObjects{lst.begin(), lst.end()};
+            std::vector<t_tTestType> vecExpected{};
+            for (size_t uThread = 0; uThread < uNumThreads; ++uThread) {
+                for (size_t i = 0; i < uNumItems; ++i) {
+                    vecExpected.push_back(MakeValue(uThread << 16 | i));
+                }
+            }
+            std::ranges::sort(vecObjects);
+            std::ranges::sort(vecExpected);
+            CHECK(vecObjects == vecExpected);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Copy-on-write list", t_tTestType, uint32_t, std::string) {
+        auto MakeValue = [](size_t i) {
+            if constexpr (std::is_same_v<t_tTestType, std::string>) {
+                return std::to_string(i);
+            } else {
+                return static_cast<t_tTestType>(i);
+            }
+        };
+        // Small blocks, so the elements span many blocks
+        eho::CListCow<t_tTestType, 64> lst{};
+        CHECK(lst.empty());
+        CHECK(lst.snapshot().empty());
+        CHECK_THROWS_AS(lst.at(0), std::out_of_range);
+        CHECK_FALSE(lst.pop().has_value());
+
+        SUBCASE("Single thread") {
+            std::vector<t_tTestType> vecObjects{};
+            for (size_t i = 0; i < 1000; ++i) {
+                lst.push_back(MakeValue(i));
+                vecObjects.push_back(MakeValue(i));
+            }
+            CHECK(lst.size() == 1000);
+            CHECK(std::ranges::equal(std::as_const(lst), vecObjects));
+            CHECK(std::ranges::equal(std::as_const(lst) | std::views::reverse, vecObjects | std::views::reverse));
+
+            // Writes after the snapshot copy the written blocks only
+            auto Snapshot = lst.snapshot();
+            const t_tTestType *pFirst = &std::as_const(lst)[0];
+            const t_tTestType *pLast = &std::as_const(lst)[999];
+            CHECK(&Snapshot[0] == pFirst);
+            lst[999] = MakeValue(0);
+            lst.at(998) = MakeValue(1);
+            CHECK(&std::as_const(lst)[0] == pFirst);
+            CHECK(&std::as_const(lst)[999] != pLast);
+            CHECK(&Snapshot[999] == pLast);
+            CHECK(std::ranges::equal(Snapshot, vecObjects));
+            CHECK(lst[999] == MakeValue(0));
+            CHECK(lst[998] == MakeValue(1));
+            vecObjects[999] = MakeValue(0);
+            vecObjects[998] = MakeValue(1);
+
+            // Appends and removals past a snapshot
+            auto Copy = Snapshot;
+            for (size_t i = 1000; i < 2000; ++i) {
+                lst.push_back(MakeValue(i));
+                vecObjects.push_back(MakeValue(i));
+            }
+            for (size_t i = 0; i < 1500; ++i) {
+                CHECK(lst.pop() == vecObjects.back());
+                vecObjects.pop_back();
+            }
+            CHECK(std::ranges::equal(std::as_const(lst), vecObjects));
+            CHECK(Copy.size() == 1000);
+            CHECK(Copy[999] == MakeValue(999));
+            CHECK_THROWS_AS(Copy.at(1000), std::out_of_range);
+
+            // The mutable iterators copy every shared block
+            auto Second = lst.snapshot();
+            std::ranges::fill(lst, MakeValue(7));
+            CHECK(std::ranges::all_of(std::as_const(lst), [&](const auto &Item) { return Item == MakeValue(7); }));
+            CHECK(std::ranges::equal(Second, vecObjects));
+
+            // The snapshots outlive the list
+            lst.clear();
+            CHECK(lst.empty());
+            lst = eho::CListCow<t_tTestType, 64>{};
+            CHECK(std::ranges::equal(Second, vecObjects));
+            CHECK(Snapshot.size() == 1000);
+        }
+
+        SUBCASE("Many threads") {
+            /**
+             * The writer increments every element between snapshots, the readers check that a snapshot
+             * never changes while they read it, then drop it on their own thread.
+             */
+            constexpr size_t uNumItems = 5'000;
+            constexpr size_t uNumReaders = 3;
+            for (size_t i = 0; i < uNumItems; ++i) {
+                lst.push_back(MakeValue(0));
+            }
+            std::atomic<bool> bDone{false};
+            std::atomic<bool> bConsistent{true};
+            std::mutex Mutex{};
+            auto Shared = lst.snapshot();
+            std::vector<std::thread> vecReaders{};
+            for (size_t uReader = 0; uReader < uNumReaders; ++uReader) {
+                vecReaders.emplace_back([&]() {
+                    while (!bDone.load()) {
+                        decltype(Shared) Snapshot{};
+                        {
+                            std::scoped_lock Lock{Mutex};
+                            Snapshot = Shared;
+                        }
+                        const t_tTestType First = Snapshot[0];
+                        bool bSame = Snapshot.size() >= uNumItems && std::ranges::all_of(
+                                Snapshot, [&](const auto &Item) { return Item == First; });
+                        bConsistent.store(bConsistent.load() && bSame);
+                    }
+                });
+            }
+            for (size_t uRound = 1; uRound <= 50; ++uRound) {
+                for (size_t i = 0; i < uNumItems; ++i) {
+                    lst[i] = MakeValue(uRound);
+                }
+                lst.push_back(MakeValue(uRound));
+                std::fill(lst.begin() + static_cast<std::ptrdiff_t>(uNumItems), lst.end(), MakeValue(uRound));
+                auto Snapshot = lst.snapshot();
+                std::scoped_lock Lock{Mutex};
+                Shared = std::move(Snapshot);
+            }
+            bDone = true;
+            for (auto &Reader: vecReaders) {
+                Reader.join();
+            }
+            CHECK(bConsistent.load());
+            CHECK(std::ranges::equal(Shared, std::as_const(lst)));
+            CHECK(lst.size() == uNumItems + 50);
+        }
     }
 
     TEST_CASE("Iterator") {
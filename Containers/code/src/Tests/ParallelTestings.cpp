@@ -0,0 +1,159 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <doctest/doctest.h>
+#include <Containers/List.hpp>
+#include <Containers/Parallel.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+/**
+ * Affine map x -> x * a + b, built from an element to test non-commutative reductions.
+ */
+struct CAffine {
+    uint64_t m_uA = 1;
+    uint64_t m_uB = 0;
+
+    CAffine() = default;
+
+    CAffine(uint32_t i) : m_uA{i % 7 + 1}, m_uB{i} {}
+
+    CAffine(uint64_t uA, uint64_t uB) : m_uA{uA}, m_uB{uB} {}
+
+    /**
+     * Applies Left then Right.
+     */
+    static CAffine Compose(const CAffine &Left, const CAffine &Right) {
+        return {Left.m_uA * Right.m_uA, Left.m_uB * Right.m_uA + Right.m_uB};
+    }
+
+    bool operator==(const CAffine &) const = default;
+};
+
+TEST_SUITE("") {
+    TEST_CASE("Thread pool") {
+        eho::CThreadPool Pool{3};
+        CHECK(Pool.concurrency() == 4);
+
+        std::vector<std::atomic<uint32_t>> vecCalls(1000);
+        for (size_t uRound = 0; uRound < 20; ++uRound) {
+            Pool.Run(vecCalls.size(), [&](size_t i) { vecCalls[i] += 1; });
+        }
+        CHECK(std::ranges::all_of(vecCalls, [](const auto &uCalls) { return uCalls == 20; }));
+
+        // The job finishes before the exception is rethrown
+        std::atomic<size_t> uDone{0};
+        CHECK_THROWS_AS(Pool.Run(100, [&](size_t i) {
+            if (i == 42) {
+                throw std::runtime_error{"Task failed"};
+            }
+            uDone += 1;
+        }), std::runtime_error);
+        CHECK(uDone == 99);
+        Pool.Run(0, [](size_t) { FAIL("No task to run"); });
+    }
+
+    TEST_CASE_TEMPLATE("Parallel algorithms", t_tList, eho::CList<uint32_t>, eho::CListAligned<uint32_t>,
+                       std::vector<uint32_t>) {
+        // Explicit pool so the ranges are split even on a single core machine
+        eho::CThreadPool Pool{3};
+        std::mt19937 Generator{42};
+
+        /**
+         * Runs Check(lst, vecObjects) on random lists of several sizes, from serial to many chunks.
+         */
+        auto ForEachSize = [&](auto Check) {
+            for (size_t uSize: {0, 10, 1'000, 100'000, 1'000'003}) {
+                CAPTURE(uSize);
+                std::vector<uint32_t> vecObjects(uSize);
+                std::ranges::generate(vecObjects, [&]() { return Generator() % 100'000; });
+                t_tList lst{};
+                if constexpr (std::is_same_v<t_tList, std::vector<uint32_t>>) {
+                    lst.assign(vecObjects.begin(), vecObjects.end());
+                } else {
+                    lst.append_range(vecObjects);
+                }
+                REQUIRE(std::ranges::equal(lst, vecObjects));
+                Check(lst, vecObjects);
+            }
+        };
+
+        SUBCASE("Sort") {
+            ForEachSize([&](t_tList &lst, std::vector<uint32_t> &vecObjects) {
+                eho::Parallel::sort(lst, std::ranges::less{}, Pool);
+                std::ranges::sort(vecObjects);
+                CHECK(std::ranges::equal(lst, vecObjects));
+
+                eho::Parallel::sort(lst, std::ranges::greater{}, Pool);
+                CHECK(std::ranges::is_sorted(lst, std::ranges::greater{}));
+            });
+        }
+
+        SUBCASE("Stable sort") {
+            ForEachSize([&](t_tList &lst, std::vector<uint32_t> &vecObjects) {
+                // Sorted by the last digit, equal digits keep their order
+                auto Compare = [](uint32_t uLeft, uint32_t uRight) { return uLeft % 10 < uRight % 10; };
+                eho::Parallel::stable_sort(lst, Compare, Pool);
+                std::ranges::stable_sort(vecObjects, Compare);
+                CHECK(std::ranges::equal(lst, vecObjects));
+            });
+        }
+
+        SUBCASE("Transform") {
+            ForEachSize([&](t_tList &lst, std::vector<uint32_t> &vecObjects) {
+                std::vector<uint64_t> vecOut(vecObjects.size());
+                auto End = eho::Parallel::transform(lst, vecOut.begin(), [](uint32_t i) { return uint64_t{i} * 3; },
+                                                    Pool);
+                CHECK(End == vecOut.end());
+                std::ranges::transform(vecObjects, vecObjects.begin(), [](uint32_t i) { return i * 3; });
+                CHECK(std::ranges::equal(vecOut, vecObjects));
+
+                // In place
+                eho::Parallel::transform(lst, lst.begin(), [](uint32_t i) { return i * 3; }, Pool);
+                CHECK(std::ranges::equal(lst, vecObjects));
+            });
+        }
+
+        SUBCASE("Reduce") {
+            ForEachSize([&](t_tList &lst, std::vector<uint32_t> &vecObjects) {
+                CHECK(eho::Parallel::reduce(lst, uint64_t{7}, std::plus<>{}, Pool) ==
+                      std::accumulate(vecObjects.begin(), vecObjects.end(), uint64_t{7}));
+
+                // Composition of affine maps is associative but not commutative, the chunks are folded in order
+                CHECK(eho::Parallel::reduce(lst, CAffine{}, CAffine::Compose, Pool) ==
+                      std::accumulate(vecObjects.begin(), vecObjects.end(), CAffine{}, CAffine::Compose));
+            });
+        }
+
+        SUBCASE("For each") {
+            ForEachSize([&](t_tList &lst, std::vector<uint32_t> &vecObjects) {
+                eho::Parallel::for_each(lst, [](uint32_t &i) { i += 1; }, Pool);
+                std::ranges::for_each(vecObjects, [](uint32_t &i) { i += 1; });
+                CHECK(std::ranges::equal(lst, vecObjects));
+            });
+        }
+
+        SUBCASE("Find") {
+            ForEachSize([&](t_tList &lst, std::vector<uint32_t> &vecObjects) {
+                CHECK(eho::Parallel::find(lst, 100'000u, Pool) == lst.end());
+                if (vecObjects.empty()) {
+                    return;
+                }
+                // The first match wins even if a later chunk finds one first
+                for (size_t uIndex: {size_t{0}, vecObjects.size() / 3, vecObjects.size() - 1}) {
+                    uint32_t uValue = vecObjects[uIndex];
+                    auto Expected = std::ranges::find(vecObjects, uValue) - vecObjects.begin();
+                    CHECK(eho::Parallel::find(lst, uValue, Pool) - lst.begin() == Expected);
+                }
+                auto Predicate = [](uint32_t i) { return i % 1000 == 999; };
+                CHECK(eho::Parallel::find_if(lst, Predicate, Pool) - lst.begin() ==
+                      std::ranges::find_if(vecObjects, Predicate) - vecObjects.begin());
+            });
+        }
+    }
+}
@@ -0,0 +1,253 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <doctest/doctest.h>
+#include <Containers/Queue.hpp>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_SUITE("") {
+    TEST_CASE_TEMPLATE("SPSC queue", t_tTestType, uint32_t, std::string) {
+        auto MakeValue = [](size_t i) {
+            if constexpr (std::is_same_v<t_tTestType, std::string>) {
+                return std::to_string(i);
+            } else {
+                return static_cast<t_tTestType>(i);
+            }
+        };
+        auto pQueue = std::make_unique<eho::CQueueSPSC<t_tTestType, 8>>();
+        auto &Queue = *pQueue;
+        CHECK(Queue.empty());
+        CHECK(Queue.capacity() == 8);
+        CHECK_FALSE(Queue.try_pop().has_value());
+
+        SUBCASE("Push and pop") {
+            for (size_t uRound = 0; uRound < 5; ++uRound) {
+                for (size_t i = 0; i < 8; ++i) {
+                    CHECK(Queue.try_push(MakeValue(uRound * 8 + i)));
+                }
+                CHECK_FALSE(Queue.try_push(MakeValue(0)));
+                CHECK(Queue.size() == 8);
+                for (size_t i = 0; i < 5; ++i) {
+                    CHECK(Queue.try_pop() == MakeValue(uRound * 8 + i));
+                }
+                for (size_t i = 5; i < 8; ++i) {
+                    CHECK(Queue.try_pop() == MakeValue(uRound * 8 + i));
+                }
+                CHECK(Queue.empty());
+            }
+        }
+
+        SUBCASE("Batches") {
+            std::vector<t_tTestType> vecItems{};
+            for (size_t i = 0; i < 20; ++i) {
+                vecItems.push_back(MakeValue(i));
+            }
+            // Wraps around the end of the slots
+            CHECK(Queue.try_push_n(std::span{vecItems}.first(5)) == 5);
+            std::vector<t_tTestType> vecOut(20);
+            CHECK(Queue.try_pop_n(std::span{vecOut}.first(3)) == 3);
+            CHECK(Queue.try_push_n(std::span{vecItems}.subspan(5)) == 6);
+            CHECK(Queue.try_push_n(vecItems) == 0);
+            CHECK(Queue.try_pop_n(std::span{vecOut}.subspan(3)) == 8);
+            CHECK(std::equal(vecOut.begin(), vecOut.begin() + 11, vecItems.begin()));
+            CHECK(Queue.try_pop_n(vecOut) == 0);
+            CHECK(Queue.empty());
+        }
+    }
+
+    TEST_CASE("SPSC queue - Two threads") {
+        constexpr size_t uNumItems = 200'000;
+        auto pQueue = std::make_unique<eho::CQueueSPSC<uint64_t, 64>>();
+        std::thread Producer{[&]() {
+            uint64_t arBatch[7];
+            for (uint64_t i = 0; i < uNumItems;) {
+                if (i % 3 == 0) {
+                    // Batches of up to 7 items
+                    size_t uCount = std::min<size_t>(7, uNumItems - i);
+                    std::iota(arBatch, arBatch + uCount, i);
+                    size_t uPushed = pQueue->try_push_n(std::span{arBatch, uCount});
+                    i += uPushed;
+                    if (uPushed == 0) {
+                        std::this_thread::yield();
+                    }
+                } else if (pQueue->try_push(i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }};
+
+        // Items arrive in order
+        uint64_t uExpected = 0;
+        bool bOrdered = true;
+        uint64_t arBatch[5];
+        while (uExpected < uNumItems) {
+            size_t uPopped = pQueue->try_pop_n(arBatch);
+            for (size_t i = 0; i < uPopped; ++i) {
+                bOrdered &= arBatch[i] == uExpected++;
+            }
+            if (auto Item = pQueue->try_pop()) {
+                bOrdered &= *Item == uExpected++;
+            } else if (uPopped == 0) {
+                std::this_thread::yield();
+            }
+        }
+        Producer.join();
+        CHECK(bOrdered);
+        CHECK(pQueue->empty());
+    }
+
+    TEST_CASE_TEMPLATE("MPMC queue", t_tTestType, uint32_t, std::string) {
+        auto MakeValue = [](size_t i) {
+            if constexpr (std::is_same_v<t_tTestType, std::string>) {
+                return std::to_string(i);
+            } else {
+                return static_cast<t_tTestType>(i);
+            }
+        };
+        auto pQueue = std::make_unique<eho::CQueueMPMC<t_tTestType, 6>>();
+        auto &Queue = *pQueue;
+        CHECK(Queue.empty());
+        CHECK(Queue.capacity() == 6);
+        CHECK_FALSE(Queue.try_pop().has_value());
+
+        SUBCASE("Push and pop") {
+            for (size_t uRound = 0; uRound < 5; ++uRound) {
+                for (size_t i = 0; i < 6; ++i) {
+                    if (i % 2 == 0) {
+                        CHECK(Queue.try_push(MakeValue(uRound * 6 + i)));
+                    } else {
+                        Queue.push(MakeValue(uRound * 6 + i));
+                    }
+                }
+                CHECK_FALSE(Queue.try_push(MakeValue(0)));
+                CHECK(Queue.size() == 6);
+                for (size_t i = 0; i < 3; ++i) {
+                    CHECK(Queue.try_pop() == MakeValue(uRound * 6 + i));
+                }
+                for (size_t i = 3; i < 6; ++i) {
+                    CHECK(Queue.pop() == MakeValue(uRound * 6 + i));
+                }
+                CHECK(Queue.empty());
+            }
+        }
+
+        SUBCASE("Batches") {
+            std::vector<t_tTestType> vecItems{};
+            for (size_t i = 0; i < 20; ++i) {
+                vecItems.push_back(MakeValue(i));
+            }
+            std::vector<t_tTestType> vecOut(20);
+            CHECK(Queue.try_push_n(std::span{vecItems}.first(4)) == 4);
+            CHECK(Queue.try_pop_n(std::span{vecOut}.first(3)) == 3);
+            // Wraps around the end of the slots
+            CHECK(Queue.try_push_n(std::span{vecItems}.subspan(4)) == 5);
+            CHECK(Queue.try_push_n(vecItems) == 0);
+            Queue.pop_n(std::span{vecOut}.subspan(3, 2));
+            Queue.push_n(std::span{vecItems}.subspan(9, 2));
+            CHECK(Queue.try_pop_n(std::span{vecOut}.subspan(5)) == 6);
+            CHECK(std::equal(vecOut.begin(), vecOut.begin() + 11, vecItems.begin()));
+            CHECK(Queue.try_pop_n(vecOut) == 0);
+            CHECK(Queue.empty());
+        }
+    }
+
+    TEST_CASE("MPMC queue - Many threads") {
+        /**
+         * Each item is a producer's index in the high bits and its sequence in the low bits.
+         * Positions are taken in order, so every consumer sees each producer's items in order.
+         */
+        constexpr size_t uNumProducers = 3;
+        constexpr size_t uNumConsumers = 3;
+        constexpr uint64_t uNumItems = 30'000;
+        auto pQueue = std::make_unique<eho::CQueueMPMC<uint64_t, 16>>();
+
+        std::vector<std::thread> vecThreads{};
+        for (size_t uProducer = 0; uProducer < uNumProducers; ++uProducer) {
+            vecThreads.emplace_back([&, uProducer]() {
+                std::array<uint64_t, 4> arBatch{};
+                for (uint64_t i = 0; i < uNumItems;) {
+                    uint64_t uItem = uProducer << 32 | i;
+                    switch (i % 4) {
+                        case 0:
+                            pQueue->push(uItem);
+                            ++i;
+                            break;
+                        case 1:
+                            if (pQueue->try_push(uItem)) {
+                                ++i;
+                            } else {
+                                std::this_thread::yield();
+                            }
+                            break;
+                        case 2:
+                            arBatch = {uItem, uItem + 1, 0, 0};
+                            pQueue->push_n(std::span{arBatch}.first(2));
+                            i += 2;
+                            break;
+                    }
+                }
+            });
+        }
+
+        std::array<std::array<uint64_t, uNumProducers>, uNumConsumers> arCounts{};
+        std::array<bool, uNumConsumers> arOrdered{};
+        for (size_t uConsumer = 0; uConsumer < uNumConsumers; ++uConsumer) {
+            vecThreads.emplace_back([&, uConsumer]() {
+                std::array<uint64_t, uNumProducers> arNext{};
+                bool bOrdered = true;
+                auto Receive = [&](uint64_t uItem) {
+                    size_t uProducer = uItem >> 32;
+                    uint64_t uSequence = uItem & 0xFFFF'FFFF;
+                    bOrdered &= uSequence >= arNext[uProducer];
+                    arNext[uProducer] = uSequence + 1;
+                    arCounts[uConsumer][uProducer] += 1;
+                };
+                // Every consumer takes a third of the items
+                std::array<uint64_t, 3> arBatch{};
+                for (uint64_t i = 0; i < uNumItems;) {
+                    if (i % 3 == 0) {
+                        Receive(pQueue->pop());
+                        ++i;
+                    } else if (i % 3 == 1) {
+                        size_t uPopped = pQueue->try_pop_n(std::span{arBatch}.first(std::min<size_t>(3, uNumItems - i)));
+                        std::for_each_n(arBatch.begin(), uPopped, Receive);
+                        i += uPopped;
+                        if (uPopped == 0) {
+                            std::this_thread::yield();
+                        }
+                    } else if (auto Item = pQueue->try_pop()) {
+                        Receive(*Item);
+                        ++i;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                arOrdered[uConsumer] = bOrdered;
+            });
+        }
+        for (auto &Thread: vecThreads) {
+            Thread.join();
+        }
+
+        CHECK(pQueue->empty());
+        for (size_t uProducer = 0; uProducer < uNumProducers; ++uProducer) {
+            uint64_t uReceived = 0;
+            for (size_t uConsumer = 0; uConsumer < uNumConsumers; ++uConsumer) {
+                uReceived += arCounts[uConsumer][uProducer];
+            }
+            CHECK(uReceived == uNumItems);
+        }
+        CHECK(std::ranges::all_of(arOrdered, std::identity{}));
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <doctest/doctest.h>
+#include <Containers/List.hpp>
+#include <Containers/Simd.hpp>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+
+TEST_SUITE("") {
+    TEST_CASE_TEMPLATE("SIMD kernels", t_tTestType, int8_t, uint16_t, uint32_t, int64_t, float, double) {
+        std::mt19937 Generator{42};
+        // Small values, so the floating point sums are exact whatever the order
+        auto MakeValue = [&]() { return static_cast<t_tTestType>(Generator() % 100); };
+
+        for (size_t uSize: {0, 1, 7, 1'000, 100'003}) {
+            CAPTURE(uSize);
+            eho::CList<t_tTestType> lst{};
+            for (size_t i = 0; i < uSize; ++i) {
+                lst.insert(MakeValue());
+            }
+            const eho::IListView<t_tTestType> &View = lst;
+
+            for (auto eLevel: {eho::Simd::ELevel::Scalar, eho::Simd::ELevel::SSE, eho::Simd::ELevel::AVX2,
+                               eho::Simd::ELevel::AVX512}) {
+                CAPTURE(static_cast<int>(eLevel));
+                if (uSize * 100 < std::numeric_limits<t_tTestType>::max()) {
+                    CHECK(eho::Simd::sum(lst, eLevel) == std::accumulate(lst.begin(), lst.end(), t_tTestType{}));
+                }
+                CHECK(eho::Simd::sum(View, eLevel) == eho::Simd::sum(lst, eho::Simd::ELevel::Scalar));
+
+                if (uSize == 0) {
+                    CHECK_FALSE(eho::Simd::min(lst, eLevel).has_value());
+                    CHECK_FALSE(eho::Simd::max(lst, eLevel).has_value());
+                    CHECK_FALSE(eho::Simd::minmax(lst, eLevel).has_value());
+                } else {
+                    auto [Min, Max] = std::ranges::minmax(lst);
+                    CHECK(eho::Simd::min(lst, eLevel) == Min);
+                    CHECK(eho::Simd::max(View, eLevel) == Max);
+                    CHECK(eho::Simd::minmax(lst, eLevel) == std::pair{Min, Max});
+                }
+
+                for (auto Value: {t_tTestType(0), t_tTestType(42), t_tTestType(100)}) {
+                    CHECK(eho::Simd::count(lst, Value, eLevel) == static_cast<size_t>(std::ranges::count(lst, Value)));
+                    CHECK(eho::Simd::find(lst, Value, eLevel) == std::ranges::find(lst, Value));
+                    CHECK(eho::Simd::find(View, Value, eLevel) == std::ranges::find(View, Value));
+                    CHECK(eho::Simd::contains(lst, Value, eLevel) == (std::ranges::find(lst, Value) != lst.end()));
+                }
+            }
+        }
+    }
+
+    TEST_CASE("SIMD kernels - Edge cases") {
+        // More matches than the narrow counters hold
+        eho::CList<uint8_t> lstBytes{};
+        for (size_t i = 0; i < 100'000; ++i) {
+            lstBytes.insert(static_cast<uint8_t>(i % 2));
+        }
+        CHECK(eho::Simd::count(lstBytes, 1) == 50'000);
+
+        // The match is the last element of a block, then the first one of the tail
+        eho::CListStatic<int32_t, 100> lstStatic{};
+        std::ranges::fill(lstStatic, 0);
+        lstStatic[31] = -1;
+        CHECK(eho::Simd::find(lstStatic, -1) - lstStatic.begin() == 31);
+        lstStatic[31] = 0;
+        lstStatic[96] = -1;
+        CHECK(eho::Simd::find(lstStatic, -1) - lstStatic.begin() == 96);
+        CHECK(eho::Simd::minmax(lstStatic) == std::pair{-1, 0});
+        CHECK_FALSE(eho::Simd::contains(lstStatic, 5));
+
+        eho::CList<double> lstDoubles{};
+        lstDoubles.append_range(std::vector<double>{3.0, -0.5, std::numeric_limits<double>::infinity(), 2.0});
+        CHECK(eho::Simd::minmax(lstDoubles) == std::pair{-0.5, std::numeric_limits<double>::infinity()});
+    }
+}